@@ -32,6 +32,7 @@ public class CoreTween : ModuleRules
 			new string[]
 			{
 				"Core",
+				"Engine",
 				"UMG",
 				"AsyncFlow"
 			}
@@ -40,8 +41,8 @@ public class CoreTween : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"CommonUI",
 				"CoreUObject",
-				"Engine",
 				"Slate",
 				"SlateCore"
 			}
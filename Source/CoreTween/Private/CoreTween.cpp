@@ -22,8 +22,17 @@
 
 #include "CoreTween.h"
 
+#include "CoreTweenCompletionAwaiter.h"
+#include "CoreTweenTimeline.h"
 #include "CoreTweenWorldSubsystem.h"
+#include "Targets/ActorTweenTarget.h"
+#include "Targets/MaterialTweenTarget.h"
+#include "Targets/SceneComponentTweenTarget.h"
+#include "Targets/SlateWidgetTweenTarget.h"
+#include "Targets/StaggerTweenTarget.h"
 #include "Targets/WidgetTweenTarget.h"
+#include "Components/Image.h"
+#include "Components/PrimitiveComponent.h"
 #include "Components/Widget.h"
 #include "Engine/World.h"
 
@@ -53,28 +62,129 @@ FCoreTweenBuilder UCoreTween::Create(UWidget* Widget, const float Duration, cons
 		Subsystem->Clear(Widget);
 	}
 
-	TSharedPtr<FWidgetTweenTarget> Target = MakeShared<FWidgetTweenTarget>(Widget);
-	return FCoreTweenBuilder(Target, Widget, Duration, Delay, bAdditive);
+	if (!Subsystem)
+	{
+		return FCoreTweenBuilder(MakeShared<FWidgetTweenTarget>(Widget), Widget, Duration, Delay, bAdditive);
+	}
+
+	// UMG writes make the Slate-side copy stale.
+	Subsystem->ResetSlateWidgetState(Widget);
+	return FCoreTweenBuilder(Subsystem->AcquireWidgetTarget(Widget), Widget, Duration, Delay, bAdditive, true);
 }
 
-int32 UCoreTween::Clear(UWidget* Widget)
+FCoreTweenBuilder UCoreTween::CreateSlate(UWidget* Widget, const float Duration, const float Delay, const bool bAdditive)
 {
 	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(Widget);
+	if (Subsystem && !bAdditive)
+	{
+		Subsystem->Clear(Widget);
+	}
+
+	TSharedPtr<FSlateWidgetTweenState> State;
+	if (Subsystem)
+	{
+		State = Subsystem->AcquireSlateWidgetState(Widget);
+	}
+	return FCoreTweenBuilder(MakeShared<FSlateWidgetTweenTarget>(Widget, State), Widget, Duration, Delay, bAdditive);
+}
+
+FCoreTweenBuilder UCoreTween::CreateStaggered(const TArrayView<UWidget* const> Widgets, const float Duration, const float StaggerDelay,
+	const ECoreTweenStaggerOrder Order, const float Delay, const bool bAdditive)
+{
+	if (!bAdditive)
+	{
+		for (UWidget* Widget : Widgets)
+		{
+			if (UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(Widget))
+			{
+				Subsystem->Clear(Widget);
+			}
+		}
+	}
+
+	// No single target object: the subsystem indexes the group under each widget via GetExtraTargetObjects().
+	return FCoreTweenBuilder(MakeShared<FStaggerTweenTarget>(Widgets, StaggerDelay, Order), nullptr, Duration, Delay, true);
+}
+
+FCoreTweenBuilder UCoreTween::CreateForActor(AActor* Actor, const float Duration, const float Delay, const bool bAdditive, const ETeleportType Teleport)
+{
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(Actor);
+	if (Subsystem && !bAdditive)
+	{
+		Subsystem->Clear(Actor);
+	}
+
+	return FCoreTweenBuilder(MakeShared<FActorTweenTarget>(Actor, Teleport), Actor, Duration, Delay, bAdditive);
+}
+
+FCoreTweenBuilder UCoreTween::CreateForComponent(USceneComponent* Component, const float Duration, const float Delay, const bool bAdditive, const ETeleportType Teleport)
+{
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(Component);
+	if (Subsystem && !bAdditive)
+	{
+		Subsystem->Clear(Component);
+	}
+
+	return FCoreTweenBuilder(MakeShared<FSceneComponentTweenTarget>(Component, Teleport), Component, Duration, Delay, bAdditive);
+}
+
+FCoreTweenBuilder UCoreTween::CreateForMaterial(UMaterialInstanceDynamic* Material, const FName Parameter, const float Duration, const float Delay, const bool bAdditive)
+{
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(Material);
+	if (Subsystem && !bAdditive)
+	{
+		Subsystem->Clear(Material);
+	}
+
+	return FCoreTweenBuilder(MakeShared<FMaterialTweenTarget>(Material, Parameter), Material, Duration, Delay, bAdditive);
+}
+
+FCoreTweenBuilder UCoreTween::CreateForImageMaterial(UImage* Image, const FName Parameter, const float Duration, const float Delay, const bool bAdditive)
+{
+	return CreateForMaterial(Image ? Image->GetDynamicMaterial() : nullptr, Parameter, Duration, Delay, bAdditive);
+}
+
+FCoreTweenBuilder UCoreTween::CreateForMeshMaterial(UPrimitiveComponent* Component, const int32 ElementIndex, const FName Parameter, const float Duration, const float Delay, const bool bAdditive)
+{
+	return CreateForMaterial(Component ? Component->CreateDynamicMaterialInstance(ElementIndex) : nullptr, Parameter, Duration, Delay, bAdditive);
+}
+
+TSharedRef<FCoreTweenTimelinePlayer> UCoreTween::BindTimeline(UWidget* Widget, const TSharedRef<const FCoreTweenTimeline>& Timeline)
+{
+	if (UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(Widget))
+	{
+		Subsystem->Clear(Widget);
+	}
+	return MakeShared<FCoreTweenTimelinePlayer>(Timeline, MakeShared<FWidgetTweenTarget>(Widget));
+}
+
+TSharedRef<FCoreTweenTimelinePlayer> UCoreTween::BindTimelineToActor(AActor* Actor, const TSharedRef<const FCoreTweenTimeline>& Timeline, const ETeleportType Teleport)
+{
+	if (UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(Actor))
+	{
+		Subsystem->Clear(Actor);
+	}
+	return MakeShared<FCoreTweenTimelinePlayer>(Timeline, MakeShared<FActorTweenTarget>(Actor, Teleport));
+}
+
+int32 UCoreTween::Clear(UObject* Object)
+{
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(Object);
 	if (!Subsystem)
 	{
 		return 0;
 	}
-	return Subsystem->Clear(Widget);
+	return Subsystem->Clear(Object);
 }
 
-bool UCoreTween::GetIsTweening(UWidget* Widget)
+bool UCoreTween::GetIsTweening(UObject* Object)
 {
-	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(Widget);
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(Object);
 	if (!Subsystem)
 	{
 		return false;
 	}
-	return Subsystem->GetIsTweening(Widget);
+	return Subsystem->GetIsTweening(Object);
 }
 
 void UCoreTween::CompleteAll(UObject* WorldContext)
@@ -87,125 +197,233 @@ void UCoreTween::CompleteAll(UObject* WorldContext)
 	Subsystem->CompleteAll();
 }
 
-void UCoreTween::RegisterTweenState(UObject* WorldContext, TSharedPtr<FCoreTweenState> State)
+bool UCoreTween::Complete(UObject* WorldContext, const FCoreTweenHandle Handle)
+{
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext);
+	return Subsystem && Subsystem->Complete(Handle);
+}
+
+bool UCoreTween::Pause(UObject* WorldContext, const FCoreTweenHandle Handle)
+{
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext);
+	return Subsystem && Subsystem->Pause(Handle);
+}
+
+bool UCoreTween::Resume(UObject* WorldContext, const FCoreTweenHandle Handle)
+{
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext);
+	return Subsystem && Subsystem->Resume(Handle);
+}
+
+bool UCoreTween::Cancel(UObject* WorldContext, const FCoreTweenHandle Handle)
+{
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext);
+	return Subsystem && Subsystem->Cancel(Handle);
+}
+
+bool UCoreTween::RetargetState(UObject* WorldContext, const FCoreTweenHandle Handle, const ECoreTweenProperty Prop, const float NewDuration, TFunctionRef<void(FCoreTweenState&)> SetTarget)
+{
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext);
+	return Subsystem && Subsystem->Retarget(Handle, Prop, NewDuration, SetTarget);
+}
+
+bool UCoreTween::IsActive(UObject* WorldContext, const FCoreTweenHandle Handle)
+{
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext);
+	return Subsystem && Subsystem->IsActive(Handle);
+}
+
+AsyncFlow::TTask<void> UCoreTween::WaitForCompletion(UObject* WorldContext, const FCoreTweenHandle Handle)
+{
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext);
+	TSharedPtr<FCoreTweenState> State = Subsystem ? Subsystem->FindShared(Handle) : nullptr;
+	if (!State || State->bFinished.load(std::memory_order_acquire) || State->Waiter)
+	{
+		co_return;
+	}
+
+	co_await FCoreTweenCompletionAwaiter(MoveTemp(State));
+}
+
+void UCoreTween::SetLODSettings(UObject* WorldContext, const FCoreTweenLODSettings& Settings)
+{
+	if (UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext))
+	{
+		Subsystem->SetLODSettings(Settings);
+	}
+}
+
+void UCoreTween::SetBudgetSettings(UObject* WorldContext, const FCoreTweenBudgetSettings& Settings)
+{
+	if (UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext))
+	{
+		Subsystem->SetBudgetSettings(Settings);
+	}
+}
+
+void UCoreTween::SetFixedStepRate(UObject* WorldContext, const int32 Hz)
+{
+	if (UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext))
+	{
+		Subsystem->SetFixedStepRate(Hz);
+	}
+}
+
+void UCoreTween::FastForwardFixedStep(UObject* WorldContext, const int32 NumSteps)
+{
+	if (UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext))
+	{
+		Subsystem->FastForwardFixedStep(NumSteps);
+	}
+}
+
+FCoreTweenHandle UCoreTween::RegisterTweenState(UObject* WorldContext, TSharedPtr<FCoreTweenState> State)
 {
 	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext);
 	if (!Subsystem)
 	{
+		return FCoreTweenHandle();
+	}
+	return Subsystem->RegisterTweenState(MoveTemp(State));
+}
+
+bool UCoreTween::RegisterTimelinePlayer(UObject* WorldContext, const TSharedRef<FCoreTweenTimelinePlayer>& Player)
+{
+	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext);
+	if (!Subsystem)
+	{
+		return false;
+	}
+	Subsystem->AddTimelinePlayer(Player);
+	return true;
+}
+
+void UCoreTween::LaunchAfterFlush(UObject* WorldContext, TFunction<void()> Launch)
+{
+	if (UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext))
+	{
+		Subsystem->LaunchAfterFlush(MoveTemp(Launch));
 		return;
 	}
-	Subsystem->RegisterTweenState(MoveTemp(State));
+	Launch();
 }
 
-TArray<TSharedPtr<FCoreTweenState>>* UCoreTween::GetActiveTweenStates(UObject* WorldContext)
+TSharedPtr<FCoreTweenState> UCoreTween::AcquireTweenState(UObject* WorldContext)
 {
 	UCoreTweenWorldSubsystem* Subsystem = GetSubsystem(WorldContext);
 	if (!Subsystem)
 	{
-		return nullptr;
+		return MakeShared<FCoreTweenState>();
 	}
-	return &Subsystem->GetActiveTweenStates();
+	return Subsystem->AcquireState();
 }
 
 // ============================================================================
 // Blueprint function library
 // ============================================================================
 
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::CreateTween(
-	UWidget* Widget, const float Duration, const float Delay, const bool bAdditive)
+namespace
 {
-	UCoreTweenParamChain* Chain = NewObject<UCoreTweenParamChain>();
-	if (Chain)
+	/** Copy Params and apply one builder setter to the copy. */
+	template <typename SetterType>
+	FORCEINLINE FCoreTweenParams WithBuilder(const FCoreTweenParams& Params, SetterType&& Setter)
 	{
-		Chain->Builder = UCoreTween::Create(Widget, Duration, Delay, bAdditive);
+		FCoreTweenParams Result = Params;
+		Setter(Result.Builder);
+		return Result;
 	}
-	return Chain;
+
+	/** Wrap a Blueprint callback for the builder. */
+	FCoreTweenSignature WrapCallback(const FCoreTweenBPSignature& Callback)
+	{
+		return FCoreTweenSignature::CreateLambda([Callback]()
+		{
+			const_cast<FCoreTweenBPSignature&>(Callback).ExecuteIfBound();
+		});
+	}
+}
+
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::CreateTween(
+	UWidget* Widget, const float Duration, const float Delay, const bool bAdditive)
+{
+	FCoreTweenParams Params;
+	Params.Builder = UCoreTween::Create(Widget, Duration, Delay, bAdditive);
+	return Params;
+}
+
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::CreateStaggeredTween(const TArray<UWidget*>& Widgets, const float Duration,
+	const float StaggerDelay, const ECoreTweenStaggerOrder Order, const float Delay, const bool bAdditive)
+{
+	FCoreTweenParams Params;
+	Params.Builder = UCoreTween::CreateStaggered(Widgets, Duration, StaggerDelay, Order, Delay, bAdditive);
+	return Params;
 }
 
-void UCoreTweenBlueprintFunctionLibrary::RunTween(UCoreTweenParamChain* Params, UObject* WorldContext)
+FCoreTweenHandle UCoreTweenBlueprintFunctionLibrary::RunTween(const FCoreTweenParams& Params, UObject* WorldContext)
 {
-	if (!Params)
+	FCoreTweenBuilder Builder = Params.Builder;
+	if (Params.OnStart.IsBound())
 	{
-		return;
+		Builder.OnStart(WrapCallback(Params.OnStart));
 	}
-	AsyncFlow::TTask<void> Task = Params->Builder.Run(WorldContext);
-	Task.Start();
-
-	// Store the task in the TweenState so the coroutine survives until completion.
-	// The TweenState is the last one registered (most recent entry in ActiveTweenStates).
-	TArray<TSharedPtr<FCoreTweenState>>* States = UCoreTween::GetActiveTweenStates(WorldContext);
-	if (States && States->Num() > 0)
+	if (Params.OnComplete.IsBound())
 	{
-		States->Last()->RunningTask = MoveTemp(Task);
+		Builder.OnComplete(WrapCallback(Params.OnComplete));
 	}
 
-	Params->ConditionalBeginDestroy();
+	// Fire-and-forget: the subsystem owns the tween, no coroutine is needed to keep it alive.
+	return Builder.Start(WorldContext);
 }
 
 // ── Property setters ────────────────────────────────────────────────
 
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::ToTranslation(UCoreTweenParamChain* Chain, const FVector2D Target) { if (Chain) { Chain->Builder.ToTranslation(Target); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::FromTranslation(UCoreTweenParamChain* Chain, const FVector2D Start) { if (Chain) { Chain->Builder.FromTranslation(Start); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::ToScale(UCoreTweenParamChain* Chain, const FVector2D Target) { if (Chain) { Chain->Builder.ToScale(Target); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::FromScale(UCoreTweenParamChain* Chain, const FVector2D Start) { if (Chain) { Chain->Builder.FromScale(Start); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::ToOpacity(UCoreTweenParamChain* Chain, const float Target) { if (Chain) { Chain->Builder.ToOpacity(Target); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::FromOpacity(UCoreTweenParamChain* Chain, const float Start) { if (Chain) { Chain->Builder.FromOpacity(Start); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::ToColor(UCoreTweenParamChain* Chain, const FLinearColor Target) { if (Chain) { Chain->Builder.ToColor(Target); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::FromColor(UCoreTweenParamChain* Chain, const FLinearColor Start) { if (Chain) { Chain->Builder.FromColor(Start); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::ToRotation(UCoreTweenParamChain* Chain, const float Target) { if (Chain) { Chain->Builder.ToRotation(Target); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::FromRotation(UCoreTweenParamChain* Chain, const float Start) { if (Chain) { Chain->Builder.FromRotation(Start); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::ToCanvasPosition(UCoreTweenParamChain* Chain, const FVector2D Target) { if (Chain) { Chain->Builder.ToCanvasPosition(Target); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::FromCanvasPosition(UCoreTweenParamChain* Chain, const FVector2D Start) { if (Chain) { Chain->Builder.FromCanvasPosition(Start); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::ToPadding(UCoreTweenParamChain* Chain, const FMargin Target) { if (Chain) { Chain->Builder.ToPadding(Target); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::FromPadding(UCoreTweenParamChain* Chain, const FMargin Start) { if (Chain) { Chain->Builder.FromPadding(Start); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::ToVisibility(UCoreTweenParamChain* Chain, const ESlateVisibility Target) { if (Chain) { Chain->Builder.ToVisibility(Target); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::FromVisibility(UCoreTweenParamChain* Chain, const ESlateVisibility Start) { if (Chain) { Chain->Builder.FromVisibility(Start); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::ToMaxDesiredHeight(UCoreTweenParamChain* Chain, const float Target) { if (Chain) { Chain->Builder.ToMaxDesiredHeight(Target); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::FromMaxDesiredHeight(UCoreTweenParamChain* Chain, const float Start) { if (Chain) { Chain->Builder.FromMaxDesiredHeight(Start); } return Chain; }
-
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::SetEasing(UCoreTweenParamChain* Chain, const ECoreTweenEasingType Easing, const float EasingParam)
-{
-	if (Chain)
-	{
-		TOptional<float> Param;
-		if (EasingParam != 0.0f)
-		{
-			Param = EasingParam;
-		}
-		Chain->Builder.Easing(Easing, Param);
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::ToTranslation(const FCoreTweenParams& Params, const FVector2D Target) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.ToTranslation(Target); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::FromTranslation(const FCoreTweenParams& Params, const FVector2D Start) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.FromTranslation(Start); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::ToScale(const FCoreTweenParams& Params, const FVector2D Target) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.ToScale(Target); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::FromScale(const FCoreTweenParams& Params, const FVector2D Start) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.FromScale(Start); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::ToOpacity(const FCoreTweenParams& Params, const float Target) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.ToOpacity(Target); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::FromOpacity(const FCoreTweenParams& Params, const float Start) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.FromOpacity(Start); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::ToColor(const FCoreTweenParams& Params, const FLinearColor Target) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.ToColor(Target); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::FromColor(const FCoreTweenParams& Params, const FLinearColor Start) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.FromColor(Start); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::ToRotation(const FCoreTweenParams& Params, const float Target) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.ToRotation(Target); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::FromRotation(const FCoreTweenParams& Params, const float Start) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.FromRotation(Start); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::ToCanvasPosition(const FCoreTweenParams& Params, const FVector2D Target) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.ToCanvasPosition(Target); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::FromCanvasPosition(const FCoreTweenParams& Params, const FVector2D Start) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.FromCanvasPosition(Start); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::ToPadding(const FCoreTweenParams& Params, const FMargin Target) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.ToPadding(Target); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::FromPadding(const FCoreTweenParams& Params, const FMargin Start) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.FromPadding(Start); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::ToVisibility(const FCoreTweenParams& Params, const ESlateVisibility Target) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.ToVisibility(Target); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::FromVisibility(const FCoreTweenParams& Params, const ESlateVisibility Start) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.FromVisibility(Start); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::ToMaxDesiredHeight(const FCoreTweenParams& Params, const float Target) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.ToMaxDesiredHeight(Target); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::FromMaxDesiredHeight(const FCoreTweenParams& Params, const float Start) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.FromMaxDesiredHeight(Start); }); }
+
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::SetEasing(const FCoreTweenParams& Params, const ECoreTweenEasingType Easing, const float EasingParam)
+{
+	TOptional<float> Param;
+	if (EasingParam != 0.0f)
+	{
+		Param = EasingParam;
 	}
-	return Chain;
+	return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.Easing(Easing, Param); });
 }
 
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::SetLoops(UCoreTweenParamChain* Chain, const int32 LoopCount) { if (Chain) { Chain->Builder.SetLoops(LoopCount); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::SetPingPong(UCoreTweenParamChain* Chain, const bool bPingPong) { if (Chain) { Chain->Builder.SetPingPong(bPingPong); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::SetTimeSource(UCoreTweenParamChain* Chain, const ECoreTweenTimeSource TimeSource) { if (Chain) { Chain->Builder.SetTimeSource(TimeSource); } return Chain; }
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::ToReset(UCoreTweenParamChain* Chain) { if (Chain) { Chain->Builder.ToReset(); } return Chain; }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::SetLoops(const FCoreTweenParams& Params, const int32 LoopCount) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.SetLoops(LoopCount); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::SetPingPong(const FCoreTweenParams& Params, const bool bPingPong) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.SetPingPong(bPingPong); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::SetTimeSource(const FCoreTweenParams& Params, const ECoreTweenTimeSource TimeSource) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.SetTimeSource(TimeSource); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::SetPriority(const FCoreTweenParams& Params, const ECoreTweenPriority Priority) { return WithBuilder(Params, [&](FCoreTweenBuilder& Builder) { Builder.SetPriority(Priority); }); }
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::ToReset(const FCoreTweenParams& Params) { return WithBuilder(Params, [](FCoreTweenBuilder& Builder) { Builder.ToReset(); }); }
 
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::OnStart(UCoreTweenParamChain* Chain, const FCoreTweenBPSignature& Callback)
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::OnStart(const FCoreTweenParams& Params, const FCoreTweenBPSignature& Callback)
 {
-	if (Chain)
-	{
-		FCoreTweenBPSignature CapturedCallback = Callback;
-		Chain->Builder.OnStart(FCoreTweenSignature::CreateLambda([CapturedCallback]()
-		{
-			const_cast<FCoreTweenBPSignature&>(CapturedCallback).ExecuteIfBound();
-		}));
-	}
-	return Chain;
+	FCoreTweenParams Result = Params;
+	Result.OnStart = Callback;
+	return Result;
 }
 
-UCoreTweenParamChain* UCoreTweenBlueprintFunctionLibrary::OnComplete(UCoreTweenParamChain* Chain, const FCoreTweenBPSignature& Callback)
+FCoreTweenParams UCoreTweenBlueprintFunctionLibrary::OnComplete(const FCoreTweenParams& Params, const FCoreTweenBPSignature& Callback)
 {
-	if (Chain)
-	{
-		FCoreTweenBPSignature CapturedCallback = Callback;
-		Chain->Builder.OnComplete(FCoreTweenSignature::CreateLambda([CapturedCallback]()
-		{
-			const_cast<FCoreTweenBPSignature&>(CapturedCallback).ExecuteIfBound();
-		}));
-	}
-	return Chain;
+	FCoreTweenParams Result = Params;
+	Result.OnComplete = Callback;
+	return Result;
 }
 
 // ── Management ──────────────────────────────────────────────────────
@@ -220,3 +438,22 @@ bool UCoreTweenBlueprintFunctionLibrary::IsTweening(UWidget* Widget)
 	return UCoreTween::GetIsTweening(Widget);
 }
 
+bool UCoreTweenBlueprintFunctionLibrary::PauseTween(const FCoreTweenHandle Handle, UObject* WorldContext)
+{
+	return UCoreTween::Pause(WorldContext, Handle);
+}
+
+bool UCoreTweenBlueprintFunctionLibrary::ResumeTween(const FCoreTweenHandle Handle, UObject* WorldContext)
+{
+	return UCoreTween::Resume(WorldContext, Handle);
+}
+
+bool UCoreTweenBlueprintFunctionLibrary::CancelTween(const FCoreTweenHandle Handle, UObject* WorldContext)
+{
+	return UCoreTween::Cancel(WorldContext, Handle);
+}
+
+bool UCoreTweenBlueprintFunctionLibrary::IsTweenActive(const FCoreTweenHandle Handle, UObject* WorldContext)
+{
+	return UCoreTween::IsActive(WorldContext, Handle);
+}
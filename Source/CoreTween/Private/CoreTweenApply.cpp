@@ -0,0 +1,178 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CoreTweenApply.h"
+
+#include "Math/UnrealMathUtility.h"
+
+namespace CoreTweenApply
+{
+	namespace
+	{
+		using EProp = ECoreTweenProperty;
+		using FEvaluateFunc = void (*)(FCoreTweenState&, float);
+		using FWriteFunc = void (*)(FCoreTweenState&);
+
+		void ApplyNone(FCoreTweenState& State, float, ECoreTweenApplyPhase)
+		{
+			State.DirtyMask = EProp::None;
+		}
+
+		void WriteNone(FCoreTweenState&)
+		{
+		}
+
+		/** One evaluator per property bit, indexed by bit position. */
+		const FEvaluateFunc PropertyEvaluators[] = {
+			&EvaluateProperty<EProp::Color>,
+			&EvaluateProperty<EProp::Opacity>,
+			&EvaluateProperty<EProp::Visibility>,
+			&EvaluateProperty<EProp::Translation>,
+			&EvaluateProperty<EProp::Scale>,
+			&EvaluateProperty<EProp::Rotation>,
+			&EvaluateProperty<EProp::CanvasPosition>,
+			&EvaluateProperty<EProp::Padding>,
+			&EvaluateProperty<EProp::MaxDesiredHeight>,
+			&EvaluateProperty<EProp::Location>,
+			&EvaluateProperty<EProp::Orientation>,
+			&EvaluateProperty<EProp::Scale3D>,
+			&EvaluateProperty<EProp::RelativeTransform>,
+			&EvaluateProperty<EProp::MaterialScalar>,
+			&EvaluateProperty<EProp::MaterialVector>,
+		};
+
+		/** One writer per property bit, indexed by bit position. Render and world transform bits are handled as groups. */
+		const FWriteFunc PropertyWriters[] = {
+			&WriteProperty<EProp::Color>,
+			&WriteProperty<EProp::Opacity>,
+			&WriteProperty<EProp::Visibility>,
+			&WriteNone,
+			&WriteNone,
+			&WriteNone,
+			&WriteProperty<EProp::CanvasPosition>,
+			&WriteProperty<EProp::Padding>,
+			&WriteProperty<EProp::MaxDesiredHeight>,
+			&WriteNone,
+			&WriteNone,
+			&WriteNone,
+			&WriteProperty<EProp::RelativeTransform>,
+			&WriteProperty<EProp::MaterialScalar>,
+			&WriteProperty<EProp::MaterialVector>,
+		};
+
+		/** Render transform writers indexed by (Mask & RenderTransformProperties) >> Translation's bit. */
+		const FWriteFunc RenderTransformWriters[] = {
+			&WriteNone,
+			&WriteRenderTransform<EProp::Translation>,
+			&WriteRenderTransform<EProp::Scale>,
+			&WriteRenderTransform<EProp::Translation | EProp::Scale>,
+			&WriteRenderTransform<EProp::Rotation>,
+			&WriteRenderTransform<EProp::Translation | EProp::Rotation>,
+			&WriteRenderTransform<EProp::Scale | EProp::Rotation>,
+			&WriteRenderTransform<EProp::Translation | EProp::Scale | EProp::Rotation>,
+		};
+
+		/** World transform writers indexed by (Mask & WorldTransformProperties) >> Location's bit. */
+		const FWriteFunc WorldTransformWriters[] = {
+			&WriteNone,
+			&WriteWorldTransform<EProp::Location>,
+			&WriteWorldTransform<EProp::Orientation>,
+			&WriteWorldTransform<EProp::Location | EProp::Orientation>,
+			&WriteWorldTransform<EProp::Scale3D>,
+			&WriteWorldTransform<EProp::Location | EProp::Scale3D>,
+			&WriteWorldTransform<EProp::Orientation | EProp::Scale3D>,
+			&WriteWorldTransform<EProp::Location | EProp::Orientation | EProp::Scale3D>,
+		};
+	} // namespace
+
+	void ApplyDynamic(FCoreTweenState& State, const float EasedAlpha, const ECoreTweenApplyPhase Phase)
+	{
+		if (EnumHasAnyFlags(Phase, ECoreTweenApplyPhase::Evaluate))
+		{
+			uint32 Bits = static_cast<uint32>(State.PropertyMask);
+			while (Bits != 0)
+			{
+				PropertyEvaluators[FMath::CountTrailingZeros(Bits)](State, EasedAlpha);
+				Bits &= Bits - 1;
+			}
+		}
+
+		if (!EnumHasAnyFlags(Phase, ECoreTweenApplyPhase::Write))
+		{
+			return;
+		}
+
+		uint32 Bits = static_cast<uint32>(State.DirtyMask & ~(RenderTransformProperties | WorldTransformProperties));
+		while (Bits != 0)
+		{
+			PropertyWriters[FMath::CountTrailingZeros(Bits)](State);
+			Bits &= Bits - 1;
+		}
+
+		constexpr uint32 TransformShift = 3;
+		static_assert(static_cast<uint32>(EProp::Translation) == 1u << TransformShift, "Render transform bits must stay contiguous");
+		const uint32 TransformBits = static_cast<uint32>(State.PropertyMask & RenderTransformProperties) >> TransformShift;
+		RenderTransformWriters[TransformBits](State);
+
+		constexpr uint32 WorldShift = 9;
+		static_assert(static_cast<uint32>(EProp::Location) == 1u << WorldShift, "World transform bits must stay contiguous");
+		const uint32 WorldBits = static_cast<uint32>(State.PropertyMask & WorldTransformProperties) >> WorldShift;
+		WorldTransformWriters[WorldBits](State);
+
+		State.DirtyMask = EProp::None;
+	}
+
+	FCoreTweenApplyFunc SelectApplier(const ECoreTweenProperty Mask)
+	{
+		switch (Mask)
+		{
+			case EProp::None:              return &ApplyNone;
+			case EProp::Color:             return &ApplyMasked<EProp::Color>;
+			case EProp::Opacity:           return &ApplyMasked<EProp::Opacity>;
+			case EProp::Visibility:        return &ApplyMasked<EProp::Visibility>;
+			case EProp::Translation:       return &ApplyMasked<EProp::Translation>;
+			case EProp::Scale:             return &ApplyMasked<EProp::Scale>;
+			case EProp::Rotation:          return &ApplyMasked<EProp::Rotation>;
+			case EProp::CanvasPosition:    return &ApplyMasked<EProp::CanvasPosition>;
+			case EProp::Padding:           return &ApplyMasked<EProp::Padding>;
+			case EProp::MaxDesiredHeight:  return &ApplyMasked<EProp::MaxDesiredHeight>;
+			case EProp::Location:          return &ApplyMasked<EProp::Location>;
+			case EProp::Orientation:       return &ApplyMasked<EProp::Orientation>;
+			case EProp::Scale3D:           return &ApplyMasked<EProp::Scale3D>;
+			case EProp::RelativeTransform: return &ApplyMasked<EProp::RelativeTransform>;
+			case EProp::MaterialScalar:    return &ApplyMasked<EProp::MaterialScalar>;
+			case EProp::MaterialVector:    return &ApplyMasked<EProp::MaterialVector>;
+
+			// Widget transition combinations (UTweenManagerSubsystem, UCoreWidget).
+			case EProp::Opacity | EProp::Translation:               return &ApplyMasked<EProp::Opacity | EProp::Translation>;
+			case EProp::Opacity | EProp::Scale:                     return &ApplyMasked<EProp::Opacity | EProp::Scale>;
+			case EProp::Translation | EProp::Scale:                 return &ApplyMasked<EProp::Translation | EProp::Scale>;
+			case EProp::Opacity | EProp::Translation | EProp::Scale: return &ApplyMasked<EProp::Opacity | EProp::Translation | EProp::Scale>;
+
+			// Door / platform combination.
+			case EProp::Location | EProp::Orientation: return &ApplyMasked<EProp::Location | EProp::Orientation>;
+
+			default:
+				return &ApplyDynamic;
+		}
+	}
+} // namespace CoreTweenApply
@@ -0,0 +1,125 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CoreTweenBatch.h"
+
+#include "CoreTweenBuilder.h"
+#include "Math/VectorRegister.h"
+
+int32 FCoreTweenBatch::Add(FCoreTweenState* State)
+{
+	const int32 Lane = States.Add(State);
+
+	// A state that starts with a negative delay (a sequence step launched mid-frame) is already that far in.
+	Elapsed.Add(State->bStarted ? FMath::Clamp(-State->DelayRemaining, 0.0f, FMath::Max(State->Duration, 0.0f)) : 0.0f);
+	Duration.Add(FMath::Max(State->Duration, 0.0f));
+	Rate.Add(State->GetLaneRate());
+	Param.Add(State->EasingParam.Get(FCoreTweenEasing::GetDefaultParam(EasingType)));
+	Curve.Add(State->EasingCurve.Get());
+	Alpha.Add(0.0f);
+
+	State->BatchLane = Lane;
+	return Lane;
+}
+
+void FCoreTweenBatch::RemoveAtSwap(const int32 Lane)
+{
+	States[Lane]->BatchLane = INDEX_NONE;
+
+	States.RemoveAtSwap(Lane, 1, EAllowShrinking::No);
+	Elapsed.RemoveAtSwap(Lane, 1, EAllowShrinking::No);
+	Duration.RemoveAtSwap(Lane, 1, EAllowShrinking::No);
+	Rate.RemoveAtSwap(Lane, 1, EAllowShrinking::No);
+	Param.RemoveAtSwap(Lane, 1, EAllowShrinking::No);
+	Curve.RemoveAtSwap(Lane, 1, EAllowShrinking::No);
+	Alpha.RemoveAtSwap(Lane, 1, EAllowShrinking::No);
+
+	if (States.IsValidIndex(Lane))
+	{
+		States[Lane]->BatchLane = Lane;
+	}
+}
+
+void FCoreTweenBatch::Evaluate(const float DeltaTime, const int32 StartLane, const int32 NumLanes)
+{
+	checkSlow(StartLane >= 0 && StartLane + NumLanes <= Num());
+	if (NumLanes <= 0)
+	{
+		return;
+	}
+
+	float* ElapsedData = Elapsed.GetData() + StartLane;
+	const float* DurationData = Duration.GetData() + StartLane;
+	const float* RateData = Rate.GetData() + StartLane;
+	float* AlphaData = Alpha.GetData() + StartLane;
+
+	// Elapsed = clamp(Elapsed + Delta * Rate, 0, Duration); Alpha = Duration > 0 ? Elapsed / Duration : 1
+	const VectorRegister4Float VDelta = VectorSetFloat1(DeltaTime);
+	int32 Lane = 0;
+	for (; Lane + 4 <= NumLanes; Lane += 4)
+	{
+		const VectorRegister4Float VDuration = VectorLoad(DurationData + Lane);
+		VectorRegister4Float VElapsed = VectorMultiplyAdd(VDelta, VectorLoad(RateData + Lane), VectorLoad(ElapsedData + Lane));
+		VElapsed = VectorMin(VectorMax(VElapsed, GlobalVectorConstants::FloatZero), VDuration);
+		VectorStore(VElapsed, ElapsedData + Lane);
+
+		const VectorRegister4Float HasDuration = VectorCompareGT(VDuration, GlobalVectorConstants::FloatZero);
+		const VectorRegister4Float SafeDuration = VectorSelect(HasDuration, VDuration, GlobalVectorConstants::FloatOne);
+		const VectorRegister4Float VAlpha = VectorSelect(HasDuration, VectorDivide(VElapsed, SafeDuration), GlobalVectorConstants::FloatOne);
+		VectorStore(VAlpha, AlphaData + Lane);
+	}
+	for (; Lane < NumLanes; ++Lane)
+	{
+		ElapsedData[Lane] = FMath::Clamp(ElapsedData[Lane] + DeltaTime * RateData[Lane], 0.0f, DurationData[Lane]);
+		AlphaData[Lane] = DurationData[Lane] > 0.0f ? ElapsedData[Lane] / DurationData[Lane] : 1.0f;
+	}
+
+	if (EasingType == ECoreTweenEasingType::Curve)
+	{
+		FCoreTweenEasing::EaseCurveBatch(Curve.GetData() + StartLane, AlphaData, NumLanes);
+	}
+	else
+	{
+		FCoreTweenEasing::EaseBatch(EasingType, AlphaData, Param.GetData() + StartLane, NumLanes);
+	}
+}
+
+void FCoreTweenBatch::Empty()
+{
+	for (FCoreTweenState* State : States)
+	{
+		State->BatchLane = INDEX_NONE;
+	}
+	States.Empty();
+	Elapsed.Empty();
+	Duration.Empty();
+	Rate.Empty();
+	Param.Empty();
+	Curve.Empty();
+	Alpha.Empty();
+}
+
+SIZE_T FCoreTweenBatch::GetAllocatedSize() const
+{
+	return States.GetAllocatedSize() + Elapsed.GetAllocatedSize() + Duration.GetAllocatedSize() + Rate.GetAllocatedSize()
+		+ Param.GetAllocatedSize() + Curve.GetAllocatedSize() + Alpha.GetAllocatedSize();
+}
@@ -0,0 +1,250 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CoreTweenBatch.h"
+#include "CoreTweenEasing.h"
+#include "CoreTweenEasingLUT.h"
+#include "CoreTweenProperty.h"
+#include "CoreTweenWorldSubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "UObject/Class.h"
+
+/**
+ * CoreTween.Benchmark.Batch [NumTweens=10000] [NumFrames=240]
+ *
+ * Micro-benchmark for the batched evaluation path. Runs the same set of
+ * randomized tweens through the per-tween scalar loop the subsystem used
+ * before batching (clamp, divide, switch-dispatched Ease) and through one
+ * FCoreTweenBatch per easing curve, then does the same for FLinearColor
+ * lerps. Only timing and easing are measured — property apply is identical
+ * in both paths. Results go to LogCoreTween.
+ */
+namespace CoreTweenBenchmark
+{
+	constexpr float FrameDelta = 1.0f / 60.0f;
+
+	struct FScalarTween
+	{
+		float Elapsed = 0.0f;
+		float Duration = 1.0f;
+		ECoreTweenEasingType EasingType = ECoreTweenEasingType::Linear;
+		TOptional<float> EasingParam;
+	};
+
+	static void RunBatchBenchmark(const TArray<FString>& Args)
+	{
+		const int32 NumTweens = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+		const int32 NumFrames = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 240;
+
+		FRandomStream Stream(0xC07E);
+
+		TArray<FScalarTween> ScalarTweens;
+		ScalarTweens.SetNum(NumTweens);
+
+		// The benchmark fills lanes directly; Evaluate() never reads States.
+		TArray<FCoreTweenBatch> Batches;
+		Batches.SetNum(FCoreTweenEasing::NumEasingTypes);
+		for (int32 EasingIdx = 0; EasingIdx < FCoreTweenEasing::NumEasingTypes; ++EasingIdx)
+		{
+			Batches[EasingIdx].EasingType = static_cast<ECoreTweenEasingType>(EasingIdx);
+		}
+
+		for (FScalarTween& Tween : ScalarTweens)
+		{
+			Tween.Duration = Stream.FRandRange(4.0f, 8.0f); // Longer than the default run, so no lane saturates at alpha 1.
+			Tween.EasingType = static_cast<ECoreTweenEasingType>(Stream.RandHelper(FCoreTweenEasing::NumEasingTypes));
+
+			FCoreTweenBatch& Batch = Batches[static_cast<int32>(Tween.EasingType)];
+			Batch.States.Add(nullptr);
+			Batch.Elapsed.Add(0.0f);
+			Batch.Duration.Add(Tween.Duration);
+			Batch.Rate.Add(1.0f);
+			Batch.Param.Add(FCoreTweenEasing::GetDefaultParam(Tween.EasingType));
+			Batch.Curve.Add(nullptr);
+			Batch.Alpha.Add(0.0f);
+		}
+
+		// ── Timing + easing ─────────────────────────────────────────
+
+		double ScalarChecksum = 0.0;
+		const double ScalarStart = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (FScalarTween& Tween : ScalarTweens)
+			{
+				Tween.Elapsed = FMath::Clamp(Tween.Elapsed + FrameDelta, 0.0f, Tween.Duration);
+				const float NormalizedAlpha = Tween.Duration > 0.0f ? Tween.Elapsed / Tween.Duration : 1.0f;
+				ScalarChecksum += FCoreTweenEasing::Ease(Tween.EasingType, NormalizedAlpha, Tween.EasingParam);
+			}
+		}
+		const double ScalarSeconds = FPlatformTime::Seconds() - ScalarStart;
+
+		double BatchChecksum = 0.0;
+		const double BatchStart = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (FCoreTweenBatch& Batch : Batches)
+			{
+				Batch.Evaluate(FrameDelta);
+				for (const float Alpha : Batch.Alpha)
+				{
+					BatchChecksum += Alpha;
+				}
+			}
+		}
+		const double BatchSeconds = FPlatformTime::Seconds() - BatchStart;
+
+		// ── Color lerp ──────────────────────────────────────────────
+
+		TArray<FLinearColor> From;
+		TArray<FLinearColor> To;
+		TArray<float> Alphas;
+		From.SetNum(NumTweens);
+		To.SetNum(NumTweens);
+		Alphas.SetNum(NumTweens);
+		for (int32 Idx = 0; Idx < NumTweens; ++Idx)
+		{
+			From[Idx] = FLinearColor(Stream.FRand(), Stream.FRand(), Stream.FRand(), Stream.FRand());
+			To[Idx] = FLinearColor(Stream.FRand(), Stream.FRand(), Stream.FRand(), Stream.FRand());
+			Alphas[Idx] = Stream.FRand();
+		}
+
+		FLinearColor ScalarColorSum = FLinearColor::Transparent;
+		const double ScalarColorStart = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (int32 Idx = 0; Idx < NumTweens; ++Idx)
+			{
+				ScalarColorSum += FMath::Lerp(From[Idx], To[Idx], Alphas[Idx]);
+			}
+		}
+		const double ScalarColorSeconds = FPlatformTime::Seconds() - ScalarColorStart;
+
+		FLinearColor VectorColorSum = FLinearColor::Transparent;
+		const double VectorColorStart = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (int32 Idx = 0; Idx < NumTweens; ++Idx)
+			{
+				VectorColorSum += CoreTweenMath::Lerp(From[Idx], To[Idx], Alphas[Idx]);
+			}
+		}
+		const double VectorColorSeconds = FPlatformTime::Seconds() - VectorColorStart;
+
+		const double Evaluations = static_cast<double>(NumTweens) * NumFrames;
+		UE_LOG(LogCoreTween, Display, TEXT("[CoreTween] Benchmark: %d tweens x %d frames"), NumTweens, NumFrames);
+		UE_LOG(LogCoreTween, Display, TEXT("[CoreTween]   Timing+easing  scalar %.2f ns/tween, batched %.2f ns/tween (%.2fx) [checksum %.3f / %.3f]"),
+			ScalarSeconds * 1e9 / Evaluations, BatchSeconds * 1e9 / Evaluations,
+			BatchSeconds > 0.0 ? ScalarSeconds / BatchSeconds : 0.0, ScalarChecksum, BatchChecksum);
+		UE_LOG(LogCoreTween, Display, TEXT("[CoreTween]   Color lerp     scalar %.2f ns/tween, vector  %.2f ns/tween (%.2fx) [checksum %.3f / %.3f]"),
+			ScalarColorSeconds * 1e9 / Evaluations, VectorColorSeconds * 1e9 / Evaluations,
+			VectorColorSeconds > 0.0 ? ScalarColorSeconds / VectorColorSeconds : 0.0, ScalarColorSum.R, VectorColorSum.R);
+
+		constexpr SIZE_T DenseOverhead = FCoreTweenPropertyStore::DenseSize - sizeof(FCoreTweenPropertyStore);
+		UE_LOG(LogCoreTween, Display, TEXT("[CoreTween]   Memory         state %d bytes (%d with dense properties), builder %d bytes (%d with dense properties)"),
+			static_cast<int32>(sizeof(FCoreTweenState)), static_cast<int32>(sizeof(FCoreTweenState) + DenseOverhead),
+			static_cast<int32>(sizeof(FCoreTweenBuilder)), static_cast<int32>(sizeof(FCoreTweenBuilder) + DenseOverhead));
+	}
+
+	static FAutoConsoleCommand BatchBenchmarkCommand(
+		TEXT("CoreTween.Benchmark.Batch"),
+		TEXT("Compare scalar vs batched SIMD tween evaluation. Args: [NumTweens=10000] [NumFrames=240]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunBatchBenchmark));
+
+	/**
+	 * CoreTween.Benchmark.EasingLUT [Resolution=256] [NumSamples=1000000]
+	 *
+	 * Error vs. speed of baked easing tables against the analytic functions,
+	 * for every curve LUT mode covers. Errors are measured on random alphas
+	 * in [0, 1]; both paths ease the same alphas in place.
+	 */
+	static void RunEasingLUTBenchmark(const TArray<FString>& Args)
+	{
+		const int32 Resolution = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : FCoreTweenEasingLUT::DefaultResolution;
+		const int32 NumSamples = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 1000000;
+
+		static constexpr ECoreTweenEasingType Curves[] = {
+			ECoreTweenEasingType::EaseInExpo, ECoreTweenEasingType::EaseOutExpo, ECoreTweenEasingType::EaseInOutExpo,
+			ECoreTweenEasingType::EaseInSine, ECoreTweenEasingType::EaseOutSine, ECoreTweenEasingType::EaseInOutSine,
+			ECoreTweenEasingType::EaseInElastic, ECoreTweenEasingType::EaseOutElastic, ECoreTweenEasingType::EaseInOutElastic,
+			ECoreTweenEasingType::Spring
+		};
+
+		FRandomStream Stream(0xC07E);
+		TArray<float> Alphas;
+		Alphas.SetNumUninitialized(NumSamples);
+		for (float& Alpha : Alphas)
+		{
+			Alpha = Stream.FRand();
+		}
+
+		TArray<float> Analytic;
+		TArray<float> Baked;
+		Analytic.SetNumUninitialized(NumSamples);
+		Baked.SetNumUninitialized(NumSamples);
+
+		UE_LOG(LogCoreTween, Display, TEXT("[CoreTween] Easing LUT benchmark: %d segments (%d bytes per table), %d samples"),
+			Resolution, (Resolution + 1) * static_cast<int32>(sizeof(float)), NumSamples);
+
+		for (const ECoreTweenEasingType Type : Curves)
+		{
+			const TSharedRef<const FCoreTweenEasingLUT> Table = FCoreTweenEasingLUT::Bake(
+				[Type](const float Alpha) { return FCoreTweenEasing::EaseAnalytic(Type, Alpha); }, Resolution);
+			const float DefaultParam = FCoreTweenEasing::GetDefaultParam(Type);
+
+			const double AnalyticStart = FPlatformTime::Seconds();
+			for (int32 Idx = 0; Idx < NumSamples; ++Idx)
+			{
+				Analytic[Idx] = FCoreTweenEasing::EaseAnalytic(Type, Alphas[Idx], DefaultParam);
+			}
+			const double AnalyticSeconds = FPlatformTime::Seconds() - AnalyticStart;
+
+			const double BakedStart = FPlatformTime::Seconds();
+			for (int32 Idx = 0; Idx < NumSamples; ++Idx)
+			{
+				Baked[Idx] = Table->Sample(Alphas[Idx]);
+			}
+			const double BakedSeconds = FPlatformTime::Seconds() - BakedStart;
+
+			double MaxError = 0.0;
+			double SumError = 0.0;
+			for (int32 Idx = 0; Idx < NumSamples; ++Idx)
+			{
+				const double Error = FMath::Abs(static_cast<double>(Baked[Idx]) - Analytic[Idx]);
+				MaxError = FMath::Max(MaxError, Error);
+				SumError += Error;
+			}
+
+			UE_LOG(LogCoreTween, Display, TEXT("[CoreTween]   %-18s analytic %.2f ns, LUT %.2f ns (%.2fx)  max err %.2e, mean err %.2e"),
+				*StaticEnum<ECoreTweenEasingType>()->GetNameStringByValue(static_cast<int64>(Type)),
+				AnalyticSeconds * 1e9 / NumSamples, BakedSeconds * 1e9 / NumSamples,
+				BakedSeconds > 0.0 ? AnalyticSeconds / BakedSeconds : 0.0, MaxError, SumError / NumSamples);
+		}
+	}
+
+	static FAutoConsoleCommand EasingLUTBenchmarkCommand(
+		TEXT("CoreTween.Benchmark.EasingLUT"),
+		TEXT("Compare baked easing tables against the analytic curves (error and ns/sample). Args: [Resolution=256] [NumSamples=1000000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunEasingLUTBenchmark));
+} // namespace CoreTweenBenchmark
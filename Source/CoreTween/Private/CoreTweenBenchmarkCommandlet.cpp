@@ -0,0 +1,200 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CoreTweenBenchmarkCommandlet.h"
+
+#if WITH_EDITOR
+
+#include "CoreTweenBuilder.h"
+#include "CoreTweenEasing.h"
+#include "CoreTweenEasingLUT.h"
+#include "CoreTweenSimulation.h"
+#include "CoreTweenWorldSubsystem.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Targets/MemoryTweenTarget.h"
+#include "UObject/Class.h"
+
+namespace
+{
+	constexpr float FrameDelta = 1.0f / 60.0f;
+
+	/** Frames run before timing, so every lane is past its start and the caches are warm. */
+	constexpr int32 WarmupFrames = 5;
+
+	/** Parse "-Key=1,2,3" into positive integers, or return Defaults if the switch is missing. */
+	TArray<int32> ParseList(const FString& Params, const TCHAR* Key, const TArray<int32>& Defaults)
+	{
+		FString Value;
+		if (!FParse::Value(*Params, Key, Value, false))
+		{
+			return Defaults;
+		}
+
+		TArray<FString> Items;
+		Value.ParseIntoArray(Items, TEXT(","));
+
+		TArray<int32> Result;
+		for (const FString& Item : Items)
+		{
+			const int32 Number = FCString::Atoi(*Item);
+			if (Number > 0)
+			{
+				Result.Add(Number);
+			}
+		}
+		return Result.Num() > 0 ? Result : Defaults;
+	}
+
+	/** Animate the first NumProperties of a fixed property list, mixing scalar, vector and color lerps. */
+	void AddProperties(FCoreTweenBuilder& Builder, const int32 NumProperties, FRandomStream& Stream)
+	{
+		const float Value = Stream.FRand();
+		const FVector2D Vector(Stream.FRandRange(-100.0f, 100.0f), Stream.FRandRange(-100.0f, 100.0f));
+
+		if (NumProperties > 0)
+		{
+			Builder.ToOpacity(Value);
+		}
+		if (NumProperties > 1)
+		{
+			Builder.ToTranslation(Vector);
+		}
+		if (NumProperties > 2)
+		{
+			Builder.ToScale(FVector2D(1.0f + Value));
+		}
+		if (NumProperties > 3)
+		{
+			Builder.ToColor(FLinearColor(Value, 1.0f - Value, Value, 1.0f));
+		}
+		if (NumProperties > 4)
+		{
+			Builder.ToRotation(Value * 360.0f);
+		}
+		if (NumProperties > 5)
+		{
+			Builder.ToCanvasPosition(Vector);
+		}
+		if (NumProperties > 6)
+		{
+			Builder.ToPadding(FMargin(Value * 10.0f));
+		}
+		if (NumProperties > 7)
+		{
+			Builder.ToMaxDesiredHeight(Value * 500.0f);
+		}
+	}
+} // namespace
+
+UCoreTweenBenchmarkCommandlet::UCoreTweenBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UCoreTweenBenchmarkCommandlet::Main(const FString& Params)
+{
+	const TArray<int32> Counts = ParseList(Params, TEXT("Counts="), {100, 1000, 10000, 100000});
+	const TArray<int32> PropertyCounts = ParseList(Params, TEXT("Properties="), {1, 2, 4, 8});
+
+	int32 NumFrames = 60;
+	FParse::Value(*Params, TEXT("Frames="), NumFrames);
+	NumFrames = FMath::Max(NumFrames, 1);
+
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		OutputPath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("CoreTween"), FString::Printf(TEXT("Benchmark-%s.csv"), *FDateTime::Now().ToString()));
+	}
+
+	const UEnum* EasingEnum = StaticEnum<ECoreTweenEasingType>();
+
+	// ECoreTweenEasingType::Curve lanes share one baked table, as designer curves do.
+	const TSharedRef<const FCoreTweenEasingLUT> Curve = FCoreTweenEasingLUT::FromCubicBezier(0.25f, 0.1f, 0.25f, 1.0f);
+	FString Csv = TEXT("Tweens,Easing,Properties,Frames,NsPerTweenFrame\n");
+
+	FCoreTweenSimulation Simulation;
+	for (const int32 NumTweens : Counts)
+	{
+		for (const int32 NumProperties : PropertyCounts)
+		{
+			for (int32 EasingIdx = 0; EasingIdx < FCoreTweenEasing::NumEasingTypes; ++EasingIdx)
+			{
+				const ECoreTweenEasingType EasingType = static_cast<ECoreTweenEasingType>(EasingIdx);
+				FRandomStream Stream(0xC07E);
+
+				// Infinite ping-pong keeps the running count constant for the whole measurement.
+				Simulation.Reset();
+				for (int32 Idx = 0; Idx < NumTweens; ++Idx)
+				{
+					FCoreTweenBuilder Builder(MakeShared<FMemoryTweenTarget>(), nullptr, Stream.FRandRange(0.5f, 2.0f), 0.0f, false);
+					if (EasingType == ECoreTweenEasingType::Curve)
+					{
+						Builder.EasingCurve(Curve);
+					}
+					else
+					{
+						Builder.Easing(EasingType);
+					}
+					Builder.SetLoops(-1).SetPingPong(true);
+					AddProperties(Builder, NumProperties, Stream);
+					Simulation.Start(Builder);
+				}
+
+				for (int32 Frame = 0; Frame < WarmupFrames; ++Frame)
+				{
+					Simulation.Tick(FrameDelta);
+				}
+
+				const double StartSeconds = FPlatformTime::Seconds();
+				for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+				{
+					Simulation.Tick(FrameDelta);
+				}
+				const double Seconds = FPlatformTime::Seconds() - StartSeconds;
+
+				const double NsPerTweenFrame = Seconds * 1e9 / (static_cast<double>(NumTweens) * NumFrames);
+				const FString EasingName = EasingEnum->GetNameStringByValue(EasingIdx);
+				Csv += FString::Printf(TEXT("%d,%s,%d,%d,%.3f\n"), NumTweens, *EasingName, NumProperties, NumFrames, NsPerTweenFrame);
+				UE_LOG(LogCoreTween, Display, TEXT("[CoreTween] Benchmark: %6d tweens  %d properties  %-18s %8.2f ns/tween/frame"),
+					NumTweens, NumProperties, *EasingName, NsPerTweenFrame);
+			}
+		}
+	}
+	Simulation.Reset();
+
+	if (!FFileHelper::SaveStringToFile(Csv, *OutputPath))
+	{
+		UE_LOG(LogCoreTween, Error, TEXT("[CoreTween] Benchmark: failed to write %s"), *OutputPath);
+		return 1;
+	}
+	UE_LOG(LogCoreTween, Display, TEXT("[CoreTween] Benchmark: results written to %s"), *OutputPath);
+	return 0;
+}
+
+#endif // WITH_EDITOR
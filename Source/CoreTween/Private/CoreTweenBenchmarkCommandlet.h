@@ -0,0 +1,54 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#if WITH_EDITOR
+
+#include "Commandlets/Commandlet.h"
+
+#include "CoreTweenBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless tween throughput benchmark. Runs FCoreTweenSimulation over
+ * FMemoryTweenTargets for every combination of tween count, easing curve and
+ * animated property count, and writes ns per tween per frame to a CSV file
+ * for regression tracking. No world, widgets or rendering are involved.
+ *
+ * UnrealEditor-Cmd <Project>.uproject -run=CoreTweenBenchmark -nullrhi -unattended
+ *     [-Counts=100,1000,10000,100000] [-Properties=1,2,4,8] [-Frames=60] [-Output=<path.csv>]
+ *
+ * The CSV defaults to Saved/Profiling/CoreTween/Benchmark-<timestamp>.csv.
+ * Editor builds only; the commandlet is not compiled into cooked games.
+ */
+UCLASS()
+class UCoreTweenBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCoreTweenBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
+
+#endif // WITH_EDITOR
@@ -23,19 +23,20 @@
 #include "CoreTweenBuilder.h"
 
 #include "CoreTween.h"
+#include "CoreTweenApply.h"
+#include "CoreTweenCompletionAwaiter.h"
 #include "AsyncFlow.h"
-#include "AsyncFlowAwaiters.h"
-#include "Engine/World.h"
-#include "Misc/App.h"
 
 FCoreTweenBuilder::FCoreTweenBuilder(
 	TSharedPtr<ICoreTweenTarget> InTarget,
-	UWidget* InWidget,
+	UObject* InTargetObject,
 	const float InDuration,
 	const float InDelay,
-	const bool bInAdditive)
+	const bool bInAdditive,
+	const bool bInPooledTarget)
 	: Target(MoveTemp(InTarget))
-	, WidgetPtr(InWidget)
+	, bPooledTarget(bInPooledTarget)
+	, TargetObject(InTargetObject)
 	, Duration(InDuration)
 	, Delay(InDelay)
 	, bAdditive(bInAdditive)
@@ -44,24 +45,36 @@ FCoreTweenBuilder::FCoreTweenBuilder(
 
 // ── Property setters ────────────────────────────────────────────────
 
-FCoreTweenBuilder& FCoreTweenBuilder::FromTranslation(const FVector2D& Value) { TranslationProp.SetStart(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::ToTranslation(const FVector2D& Value) { TranslationProp.SetTarget(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::FromScale(const FVector2D& Value) { ScaleProp.SetStart(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::ToScale(const FVector2D& Value) { ScaleProp.SetTarget(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::FromOpacity(const float Value) { OpacityProp.SetStart(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::ToOpacity(const float Value) { OpacityProp.SetTarget(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::FromColor(const FLinearColor& Value) { ColorProp.SetStart(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::ToColor(const FLinearColor& Value) { ColorProp.SetTarget(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::FromRotation(const float Value) { RotationProp.SetStart(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::ToRotation(const float Value) { RotationProp.SetTarget(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::FromCanvasPosition(const FVector2D& Value) { CanvasPositionProp.SetStart(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::ToCanvasPosition(const FVector2D& Value) { CanvasPositionProp.SetTarget(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::FromPadding(const FMargin& Value) { PaddingProp.SetStart(FVector4(Value.Left, Value.Top, Value.Right, Value.Bottom)); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::ToPadding(const FMargin& Value) { PaddingProp.SetTarget(FVector4(Value.Left, Value.Top, Value.Right, Value.Bottom)); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::FromVisibility(const ESlateVisibility Value) { VisibilityProp.SetStart(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::ToVisibility(const ESlateVisibility Value) { VisibilityProp.SetTarget(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::FromMaxDesiredHeight(const float Value) { MaxDesiredHeightProp.SetStart(Value); return *this; }
-FCoreTweenBuilder& FCoreTweenBuilder::ToMaxDesiredHeight(const float Value) { MaxDesiredHeightProp.SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromTranslation(const FVector2D& Value) { Properties.FindOrAdd<ECoreTweenProperty::Translation>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToTranslation(const FVector2D& Value) { Properties.FindOrAdd<ECoreTweenProperty::Translation>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromScale(const FVector2D& Value) { Properties.FindOrAdd<ECoreTweenProperty::Scale>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToScale(const FVector2D& Value) { Properties.FindOrAdd<ECoreTweenProperty::Scale>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromOpacity(const float Value) { Properties.FindOrAdd<ECoreTweenProperty::Opacity>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToOpacity(const float Value) { Properties.FindOrAdd<ECoreTweenProperty::Opacity>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromColor(const FLinearColor& Value) { Properties.FindOrAdd<ECoreTweenProperty::Color>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToColor(const FLinearColor& Value) { Properties.FindOrAdd<ECoreTweenProperty::Color>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromRotation(const float Value) { Properties.FindOrAdd<ECoreTweenProperty::Rotation>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToRotation(const float Value) { Properties.FindOrAdd<ECoreTweenProperty::Rotation>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromCanvasPosition(const FVector2D& Value) { Properties.FindOrAdd<ECoreTweenProperty::CanvasPosition>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToCanvasPosition(const FVector2D& Value) { Properties.FindOrAdd<ECoreTweenProperty::CanvasPosition>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromPadding(const FMargin& Value) { Properties.FindOrAdd<ECoreTweenProperty::Padding>().SetStart(FVector4(Value.Left, Value.Top, Value.Right, Value.Bottom)); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToPadding(const FMargin& Value) { Properties.FindOrAdd<ECoreTweenProperty::Padding>().SetTarget(FVector4(Value.Left, Value.Top, Value.Right, Value.Bottom)); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromVisibility(const ESlateVisibility Value) { Properties.FindOrAdd<ECoreTweenProperty::Visibility>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToVisibility(const ESlateVisibility Value) { Properties.FindOrAdd<ECoreTweenProperty::Visibility>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromMaxDesiredHeight(const float Value) { Properties.FindOrAdd<ECoreTweenProperty::MaxDesiredHeight>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToMaxDesiredHeight(const float Value) { Properties.FindOrAdd<ECoreTweenProperty::MaxDesiredHeight>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromLocation(const FVector& Value) { Properties.FindOrAdd<ECoreTweenProperty::Location>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToLocation(const FVector& Value) { Properties.FindOrAdd<ECoreTweenProperty::Location>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromOrientation(const FQuat& Value) { Properties.FindOrAdd<ECoreTweenProperty::Orientation>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToOrientation(const FQuat& Value) { Properties.FindOrAdd<ECoreTweenProperty::Orientation>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromScale3D(const FVector& Value) { Properties.FindOrAdd<ECoreTweenProperty::Scale3D>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToScale3D(const FVector& Value) { Properties.FindOrAdd<ECoreTweenProperty::Scale3D>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromRelativeTransform(const FTransform& Value) { Properties.FindOrAdd<ECoreTweenProperty::RelativeTransform>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToRelativeTransform(const FTransform& Value) { Properties.FindOrAdd<ECoreTweenProperty::RelativeTransform>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromMaterialScalar(const float Value) { Properties.FindOrAdd<ECoreTweenProperty::MaterialScalar>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToMaterialScalar(const float Value) { Properties.FindOrAdd<ECoreTweenProperty::MaterialScalar>().SetTarget(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::FromMaterialVector(const FLinearColor& Value) { Properties.FindOrAdd<ECoreTweenProperty::MaterialVector>().SetStart(Value); return *this; }
+FCoreTweenBuilder& FCoreTweenBuilder::ToMaterialVector(const FLinearColor& Value) { Properties.FindOrAdd<ECoreTweenProperty::MaterialVector>().SetTarget(Value); return *this; }
 
 // ── Configuration ───────────────────────────────────────────────────
 
@@ -72,13 +85,31 @@ FCoreTweenBuilder& FCoreTweenBuilder::Easing(const ECoreTweenEasingType InType,
 	return *this;
 }
 
+FCoreTweenBuilder& FCoreTweenBuilder::EasingCurve(const UCurveFloat* Curve)
+{
+	return EasingCurve(FCoreTweenEasingLUT::FromCurve(Curve));
+}
+
+FCoreTweenBuilder& FCoreTweenBuilder::EasingCurve(const TSharedPtr<const FCoreTweenEasingLUT>& Curve)
+{
+	EasingType = ECoreTweenEasingType::Curve;
+	EasingParam.Reset();
+	EasingCurveTable = Curve;
+	return *this;
+}
+
+FCoreTweenBuilder& FCoreTweenBuilder::EasingBezier(const float X1, const float Y1, const float X2, const float Y2)
+{
+	return EasingCurve(FCoreTweenEasingLUT::FromCubicBezier(X1, Y1, X2, Y2));
+}
+
 FCoreTweenBuilder& FCoreTweenBuilder::ToReset()
 {
-	ScaleProp.SetTarget(FVector2D::UnitVector);
-	OpacityProp.SetTarget(1.0f);
-	TranslationProp.SetTarget(FVector2D::ZeroVector);
-	ColorProp.SetTarget(FLinearColor::White);
-	RotationProp.SetTarget(0.0f);
+	Properties.FindOrAdd<ECoreTweenProperty::Scale>().SetTarget(FVector2D::UnitVector);
+	Properties.FindOrAdd<ECoreTweenProperty::Opacity>().SetTarget(1.0f);
+	Properties.FindOrAdd<ECoreTweenProperty::Translation>().SetTarget(FVector2D::ZeroVector);
+	Properties.FindOrAdd<ECoreTweenProperty::Color>().SetTarget(FLinearColor::White);
+	Properties.FindOrAdd<ECoreTweenProperty::Rotation>().SetTarget(0.0f);
 	return *this;
 }
 
@@ -106,6 +137,26 @@ FCoreTweenBuilder& FCoreTweenBuilder::SetTimeSource(const ECoreTweenTimeSource S
 	return *this;
 }
 
+FCoreTweenBuilder& FCoreTweenBuilder::SetLODPolicy(const ECoreTweenLODPolicy Policy, const int32 ThrottleInterval)
+{
+	LODPolicy = Policy;
+	LODThrottleInterval = FMath::Max(ThrottleInterval, 0);
+	return *this;
+}
+
+FCoreTweenBuilder& FCoreTweenBuilder::SetPriority(const ECoreTweenPriority InPriority)
+{
+	Priority = InPriority;
+	return *this;
+}
+
+FCoreTweenBuilder& FCoreTweenBuilder::Follow(const float SmoothTime)
+{
+	bFollow = true;
+	FollowSmoothTime = SmoothTime;
+	return *this;
+}
+
 FCoreTweenBuilder& FCoreTweenBuilder::OnStart(const FCoreTweenSignature& InDelegate)
 {
 	OnStartDelegate = InDelegate;
@@ -118,351 +169,416 @@ FCoreTweenBuilder& FCoreTweenBuilder::OnComplete(const FCoreTweenSignature& InDe
 	return *this;
 }
 
-// ── Internal helpers ────────────────────────────────────────────────
-
-void FCoreTweenBuilder::BeginAllProperties()
+FCoreTweenBuilder& FCoreTweenBuilder::WithStaticApplier(const ECoreTweenProperty StaticMask, const FCoreTweenApplyFunc InApplier)
 {
-	if (!Target || !Target->IsTargetValid())
-	{
-		return;
-	}
-
-	TranslationProp.OnBegin(Target->GetCurrentTranslation());
-	ScaleProp.OnBegin(Target->GetCurrentScale());
-	OpacityProp.OnBegin(Target->GetCurrentOpacity());
-	ColorProp.OnBegin(Target->GetCurrentColor());
-	RotationProp.OnBegin(Target->GetCurrentRotation());
-	CanvasPositionProp.OnBegin(Target->GetCurrentCanvasPosition());
-	PaddingProp.OnBegin(Target->GetCurrentPadding());
-	VisibilityProp.OnBegin(Target->GetCurrentVisibility());
-	MaxDesiredHeightProp.OnBegin(Target->GetCurrentMaxDesiredHeight());
+	StaticPropertyMask = StaticMask;
+	StaticApplier = InApplier;
+	return *this;
 }
 
-void FCoreTweenBuilder::ApplyAll(const float EasedAlpha)
+float FCoreTweenBuilder::GetTotalDuration() const
 {
-	if (!Target || !Target->IsTargetValid())
-	{
-		return;
-	}
-
-	if (ColorProp.IsSet())
-	{
-		ColorProp.Update(EasedAlpha);
-		Target->ApplyColor(ColorProp.CurrentValue);
-	}
+	const int32 Laps = FMath::Max(LoopCount, 1) * (bPingPong ? 2 : 1);
+	return FMath::Max(Delay, 0.0f) + FMath::Max(Duration, 0.0f) * Laps;
+}
 
-	if (OpacityProp.IsSet())
-	{
-		OpacityProp.Update(EasedAlpha);
-		Target->ApplyOpacity(OpacityProp.CurrentValue);
-	}
+// ── FCoreTweenState ─────────────────────────────────────────────────
 
-	if (VisibilityProp.IsSet())
-	{
-		if (VisibilityProp.Update(EasedAlpha))
-		{
-			Target->ApplyVisibility(VisibilityProp.CurrentValue);
-		}
-	}
+void FCoreTweenState::Begin()
+{
+	ReadFromCurrent();
 
-	bool bChangedRenderTransform = false;
+	// Apply starting state immediately (eased alpha = 0)
+	ApplyAll(0.0f);
 
-	if (TranslationProp.IsSet())
-	{
-		TranslationProp.Update(EasedAlpha);
-		bChangedRenderTransform = true;
-	}
-	if (ScaleProp.IsSet())
+	if (DelayRemaining <= 0.0f)
 	{
-		ScaleProp.Update(EasedAlpha);
-		bChangedRenderTransform = true;
-	}
-	if (RotationProp.IsSet())
-	{
-		if (RotationProp.Update(EasedAlpha))
-		{
-			bChangedRenderTransform = true;
-		}
+		bStarted = true;
+		OnStartDelegate.ExecuteIfBound();
 	}
+}
 
-	if (bChangedRenderTransform)
+void FCoreTweenState::ReadFromCurrent()
+{
+	// Read current values from target for "from current" defaults — only for animated properties.
+	if (Target && Target->IsTargetValid())
 	{
-		if (TranslationProp.IsSet())
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::Translation))
 		{
-			Target->ApplyTranslation(TranslationProp.CurrentValue);
+			Properties.Get<ECoreTweenProperty::Translation>().OnBegin(Target->GetCurrentTranslation());
 		}
-		if (ScaleProp.IsSet())
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::Scale))
 		{
-			Target->ApplyScale(ScaleProp.CurrentValue);
+			Properties.Get<ECoreTweenProperty::Scale>().OnBegin(Target->GetCurrentScale());
 		}
-		if (RotationProp.IsSet())
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::Opacity))
 		{
-			Target->ApplyRotation(RotationProp.CurrentValue);
+			Properties.Get<ECoreTweenProperty::Opacity>().OnBegin(Target->GetCurrentOpacity());
 		}
-	}
-
-	if (CanvasPositionProp.IsSet())
-	{
-		if (CanvasPositionProp.Update(EasedAlpha))
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::Color))
 		{
-			Target->ApplyCanvasPosition(CanvasPositionProp.CurrentValue);
+			Properties.Get<ECoreTweenProperty::Color>().OnBegin(Target->GetCurrentColor());
 		}
-	}
-
-	if (PaddingProp.IsSet())
-	{
-		if (PaddingProp.Update(EasedAlpha))
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::Rotation))
 		{
-			Target->ApplyPadding(PaddingProp.CurrentValue);
+			Properties.Get<ECoreTweenProperty::Rotation>().OnBegin(Target->GetCurrentRotation());
 		}
-	}
-
-	if (MaxDesiredHeightProp.IsSet())
-	{
-		if (MaxDesiredHeightProp.Update(EasedAlpha))
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::CanvasPosition))
 		{
-			Target->ApplyMaxDesiredHeight(MaxDesiredHeightProp.CurrentValue);
+			Properties.Get<ECoreTweenProperty::CanvasPosition>().OnBegin(Target->GetCurrentCanvasPosition());
 		}
-	}
-}
-
-// ── Coroutine runner ────────────────────────────────────────────────
-
-AsyncFlow::TTask<void> FCoreTweenBuilder::Run(UObject* WorldContext)
-{
-	// Move all builder state into coroutine-local variables before any suspension.
-	// The builder may be a temporary destroyed after the first co_await.
-	TSharedPtr<ICoreTweenTarget> LocalTarget = MoveTemp(Target);
-	const float LocalDuration = Duration;
-	const float LocalDelay = Delay;
-	const ECoreTweenEasingType LocalEasingType = EasingType;
-	const TOptional<float> LocalEasingParam = EasingParam;
-	const int32 LocalLoopCount = LoopCount;
-	const bool bLocalPingPong = bPingPong;
-	const ECoreTweenTimeSource LocalTimeSource = TimeSource;
-
-	TCoreTweenProp<FVector2D> LocalTranslationProp = MoveTemp(TranslationProp);
-	TCoreTweenProp<FVector2D> LocalScaleProp = MoveTemp(ScaleProp);
-	TCoreTweenProp<FLinearColor> LocalColorProp = MoveTemp(ColorProp);
-	TCoreTweenProp<float> LocalOpacityProp = MoveTemp(OpacityProp);
-	TCoreTweenProp<float> LocalRotationProp = MoveTemp(RotationProp);
-	TCoreTweenProp<FVector2D> LocalCanvasPositionProp = MoveTemp(CanvasPositionProp);
-	TCoreTweenProp<FVector4> LocalPaddingProp = MoveTemp(PaddingProp);
-	TCoreTweenInstantProp<ESlateVisibility> LocalVisibilityProp = MoveTemp(VisibilityProp);
-	TCoreTweenProp<float> LocalMaxDesiredHeightProp = MoveTemp(MaxDesiredHeightProp);
-
-	FCoreTweenSignature LocalOnStartDelegate = MoveTemp(OnStartDelegate);
-	FCoreTweenSignature LocalOnCompleteDelegate = MoveTemp(OnCompleteDelegate);
-
-	// Lambda that applies all active properties to the target
-	auto ApplyAllLocal = [&](float EasedAlpha)
-	{
-		if (!LocalTarget || !LocalTarget->IsTargetValid())
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::Padding))
 		{
-			return;
+			Properties.Get<ECoreTweenProperty::Padding>().OnBegin(Target->GetCurrentPadding());
 		}
-
-		if (LocalColorProp.IsSet())
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::Visibility))
 		{
-			LocalColorProp.Update(EasedAlpha);
-			LocalTarget->ApplyColor(LocalColorProp.CurrentValue);
+			Properties.Get<ECoreTweenProperty::Visibility>().OnBegin(Target->GetCurrentVisibility());
 		}
-		if (LocalOpacityProp.IsSet())
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::MaxDesiredHeight))
 		{
-			LocalOpacityProp.Update(EasedAlpha);
-			LocalTarget->ApplyOpacity(LocalOpacityProp.CurrentValue);
+			Properties.Get<ECoreTweenProperty::MaxDesiredHeight>().OnBegin(Target->GetCurrentMaxDesiredHeight());
 		}
-		if (LocalVisibilityProp.IsSet())
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::Location))
 		{
-			if (LocalVisibilityProp.Update(EasedAlpha))
-			{
-				LocalTarget->ApplyVisibility(LocalVisibilityProp.CurrentValue);
-			}
+			Properties.Get<ECoreTweenProperty::Location>().OnBegin(Target->GetCurrentLocation());
 		}
-
-		bool bChangedRenderTransform = false;
-		if (LocalTranslationProp.IsSet())
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::Orientation))
 		{
-			LocalTranslationProp.Update(EasedAlpha);
-			bChangedRenderTransform = true;
+			Properties.Get<ECoreTweenProperty::Orientation>().OnBegin(Target->GetCurrentOrientation());
 		}
-		if (LocalScaleProp.IsSet())
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::Scale3D))
 		{
-			LocalScaleProp.Update(EasedAlpha);
-			bChangedRenderTransform = true;
+			Properties.Get<ECoreTweenProperty::Scale3D>().OnBegin(Target->GetCurrentScale3D());
 		}
-		if (LocalRotationProp.IsSet())
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::RelativeTransform))
 		{
-			if (LocalRotationProp.Update(EasedAlpha))
-			{
-				bChangedRenderTransform = true;
-			}
+			Properties.Get<ECoreTweenProperty::RelativeTransform>().OnBegin(Target->GetCurrentRelativeTransform());
 		}
-		if (bChangedRenderTransform)
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::MaterialScalar))
 		{
-			if (LocalTranslationProp.IsSet())
-			{
-				LocalTarget->ApplyTranslation(LocalTranslationProp.CurrentValue);
-			}
-			if (LocalScaleProp.IsSet())
-			{
-				LocalTarget->ApplyScale(LocalScaleProp.CurrentValue);
-			}
-			if (LocalRotationProp.IsSet())
-			{
-				LocalTarget->ApplyRotation(LocalRotationProp.CurrentValue);
-			}
+			Properties.Get<ECoreTweenProperty::MaterialScalar>().OnBegin(Target->GetCurrentMaterialScalar());
 		}
-
-		if (LocalCanvasPositionProp.IsSet())
+		if (EnumHasAnyFlags(PropertyMask, ECoreTweenProperty::MaterialVector))
 		{
-			if (LocalCanvasPositionProp.Update(EasedAlpha))
-			{
-				LocalTarget->ApplyCanvasPosition(LocalCanvasPositionProp.CurrentValue);
-			}
+			Properties.Get<ECoreTweenProperty::MaterialVector>().OnBegin(Target->GetCurrentMaterialVector());
 		}
-		if (LocalPaddingProp.IsSet())
+	}
+}
+
+void FCoreTweenState::InvalidateCurrent()
+{
+	Properties.ForEach([](auto& Prop) { Prop.bIsFirstTime = true; });
+}
+
+void FCoreTweenState::Rebase(const float EaseSlope, const float VelocityDecay)
+{
+	Properties.ForEach([EaseSlope, VelocityDecay](auto& Prop) { Prop.Rebase(EaseSlope, VelocityDecay); });
+}
+
+void FCoreTweenState::Advance(const float DeltaTime, const float EasedAlpha, float& Elapsed, float& Rate, const bool bEvaluate)
+{
+	if (bForceComplete.load(std::memory_order_acquire))
+	{
+		StepEvents = ECoreTweenStepEvents::ForceComplete;
+		return;
+	}
+
+	StepEvents = ECoreTweenStepEvents::None;
+
+	// Delay phase — the lane's rate is 0 so the batch left Elapsed alone.
+	// OnStart fires on the frame the delay runs out, interpolation begins on the next one.
+	if (!bStarted)
+	{
+		DelayRemaining -= DeltaTime;
+		if (DelayRemaining <= 0.0f)
 		{
-			if (LocalPaddingProp.Update(EasedAlpha))
-			{
-				LocalTarget->ApplyPadding(LocalPaddingProp.CurrentValue);
-			}
+			bStarted = true;
+			Rate = GetLaneRate();
+			StepEvents = ECoreTweenStepEvents::Started;
 		}
-		if (LocalMaxDesiredHeightProp.IsSet())
+		return;
+	}
+
+	// Follow mode has no laps: step the springs by the time since the last evaluated frame.
+	if (bFollow)
+	{
+		FollowDelta += DeltaTime;
+		if (Applier && bEvaluate)
 		{
-			if (LocalMaxDesiredHeightProp.Update(EasedAlpha))
-			{
-				LocalTarget->ApplyMaxDesiredHeight(LocalMaxDesiredHeightProp.CurrentValue);
-			}
+			Applier(*this, EasedAlpha, ECoreTweenApplyPhase::Evaluate);
+			StepEvents |= ECoreTweenStepEvents::Evaluated;
+			FollowDelta = 0.0f;
 		}
-	};
+		return;
+	}
 
-	// Tween state for external tracking
-	TSharedPtr<FCoreTweenState> TweenState = MakeShared<FCoreTweenState>();
-	TweenState->Widget = WidgetPtr;
-	UCoreTween::RegisterTweenState(WorldContext, TweenState);
+	// A retargeted lap adds V * Duration * a(1-a)^2: velocity V at a = 0, no offset and no velocity at a = 1.
+	if (bCarryVelocity)
+	{
+		const float LapAlpha = Duration > 0.0f ? FMath::Clamp(Elapsed / Duration, 0.0f, 1.0f) : 1.0f;
+		VelocityWeight = Duration * LapAlpha * FMath::Square(1.0f - LapAlpha);
+	}
 
-	// Read current values from target for "from current" defaults
-	if (LocalTarget && LocalTarget->IsTargetValid())
+	const bool bLapComplete = bForward ? (Elapsed >= Duration) : (Elapsed <= 0.0f);
+	if (bLapComplete)
 	{
-		LocalTranslationProp.OnBegin(LocalTarget->GetCurrentTranslation());
-		LocalScaleProp.OnBegin(LocalTarget->GetCurrentScale());
-		LocalOpacityProp.OnBegin(LocalTarget->GetCurrentOpacity());
-		LocalColorProp.OnBegin(LocalTarget->GetCurrentColor());
-		LocalRotationProp.OnBegin(LocalTarget->GetCurrentRotation());
-		LocalCanvasPositionProp.OnBegin(LocalTarget->GetCurrentCanvasPosition());
-		LocalPaddingProp.OnBegin(LocalTarget->GetCurrentPadding());
-		LocalVisibilityProp.OnBegin(LocalTarget->GetCurrentVisibility());
-		LocalMaxDesiredHeightProp.OnBegin(LocalTarget->GetCurrentMaxDesiredHeight());
+		StepEvents = FinishLap(Elapsed, Rate);
 	}
 
-	// Apply starting state immediately (eased alpha = 0)
-	ApplyAllLocal(0.0f);
+	// EasedAlpha was sampled before any rewind above, so the lap's end value is what gets written.
+	if (Applier && (bEvaluate || StepEvents == ECoreTweenStepEvents::Completed))
+	{
+		Applier(*this, EasedAlpha, ECoreTweenApplyPhase::Evaluate);
+		StepEvents |= ECoreTweenStepEvents::Evaluated;
+	}
+}
 
-	// Delay phase
-	if (LocalDelay > 0.0f)
+void FCoreTweenState::Present(const float PresentElapsed)
+{
+	if (!Applier || bFollow || !bStarted || EnumHasAnyFlags(StepEvents, ECoreTweenStepEvents::Completed | ECoreTweenStepEvents::ForceComplete))
 	{
-		switch (LocalTimeSource)
+		return;
+	}
+	const float Alpha = Duration > 0.0f ? FMath::Clamp(PresentElapsed / Duration, 0.0f, 1.0f) : 1.0f;
+	Applier(*this, Ease(Alpha), ECoreTweenApplyPhase::Evaluate);
+	StepEvents |= ECoreTweenStepEvents::Evaluated;
+}
+
+ECoreTweenStepEvents FCoreTweenState::FinishLap(float& Elapsed, float& Rate)
+{
+	// Velocity carried in by a retarget only shapes the lap it was carried into.
+	bCarryVelocity = false;
+	VelocityWeight = 0.0f;
+
+	if (bPingPong)
+	{
+		bForward = !bForward;
+		Rate = GetLaneRate();
+		if (!bForward)
 		{
-			case ECoreTweenTimeSource::GameTime:
-				co_await AsyncFlow::Delay(WorldContext, LocalDelay);
-				break;
-			case ECoreTweenTimeSource::Unpaused:
-				co_await AsyncFlow::UnpausedDelay(WorldContext, LocalDelay);
-				break;
-			case ECoreTweenTimeSource::RealTime:
-				co_await AsyncFlow::RealDelay(WorldContext, LocalDelay);
-				break;
+			return ECoreTweenStepEvents::None;
 		}
 	}
 
-	// Fire OnStart callback
-	LocalOnStartDelegate.ExecuteIfBound();
+	if (LoopsRemaining > 0)
+	{
+		LoopsRemaining--;
+	}
+	if (LoopsRemaining == 0)
+	{
+		return ECoreTweenStepEvents::Completed;
+	}
+
+	Elapsed = 0.0f;
+	bForward = true;
+	Rate = GetLaneRate();
+	return ECoreTweenStepEvents::None;
+}
 
-	// Store flow state for external cancellation
-	AsyncFlow::FAsyncFlowState* CurrentFlowState = AsyncFlow::Private::GetCurrentFlowState();
-	if (CurrentFlowState)
+bool FCoreTweenState::Commit(const bool bDeferWrite)
+{
+	const ECoreTweenStepEvents Events = StepEvents;
+	StepEvents = ECoreTweenStepEvents::None;
+
+	if (!Target || !Target->IsTargetValid())
 	{
-		TweenState->FlowState = MakeShareable(CurrentFlowState, [](AsyncFlow::FAsyncFlowState*) {});
+		return true;
 	}
 
-	// Interpolation loop
-	float ElapsedTime = 0.0f;
-	int32 LoopsRemaining = LocalLoopCount;
-	bool bForward = true;
+	if (EnumHasAnyFlags(Events, ECoreTweenStepEvents::ForceComplete))
+	{
+		// Land exactly on the targets, whether easing, carrying velocity or following.
+		bFollow = false;
+		bCarryVelocity = false;
+		VelocityWeight = 0.0f;
+		ApplyAll(Ease(1.0f));
+		OnCompleteDelegate.ExecuteIfBound();
+		return true;
+	}
 
-	while (true)
+	if (EnumHasAnyFlags(Events, ECoreTweenStepEvents::Started))
 	{
-		co_await AsyncFlow::NextTick(WorldContext);
+		OnStartDelegate.ExecuteIfBound();
+	}
 
-		if (!LocalTarget || !LocalTarget->IsTargetValid())
+	// DirtyMask keeps accumulating while a write is deferred, so the late write covers every changed property.
+	if (EnumHasAnyFlags(Events, ECoreTweenStepEvents::Evaluated) || bWritePending)
+	{
+		if (bDeferWrite && !EnumHasAnyFlags(Events, ECoreTweenStepEvents::Completed))
 		{
-			TweenState->FlowState.Reset();
-			TweenState->bFinished.store(true, std::memory_order_release);
-			co_return;
+			bWritePending = true;
 		}
-
-		if (TweenState->bForceComplete.load(std::memory_order_acquire))
+		else
 		{
-			ApplyAllLocal(FCoreTweenEasing::Ease(LocalEasingType, 1.0f, LocalEasingParam));
-			LocalOnCompleteDelegate.ExecuteIfBound();
-			TweenState->FlowState.Reset();
-			TweenState->bFinished.store(true, std::memory_order_release);
-			co_return;
+			Applier(*this, 0.0f, ECoreTweenApplyPhase::Write);
+			bWritePending = false;
 		}
+	}
 
-		float DeltaTime = 0.0f;
-		switch (LocalTimeSource)
-		{
-			case ECoreTweenTimeSource::GameTime:
-			{
-				UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
-				DeltaTime = World ? World->GetDeltaSeconds() : FApp::GetDeltaTime();
-				break;
-			}
-			case ECoreTweenTimeSource::Unpaused:
-			case ECoreTweenTimeSource::RealTime:
-				DeltaTime = FApp::GetDeltaTime();
-				break;
-		}
+	if (EnumHasAnyFlags(Events, ECoreTweenStepEvents::Completed))
+	{
+		OnCompleteDelegate.ExecuteIfBound();
+		return true;
+	}
+	return false;
+}
 
-		ElapsedTime += (bForward ? DeltaTime : -DeltaTime);
-		ElapsedTime = FMath::Clamp(ElapsedTime, 0.0f, LocalDuration);
+float FCoreTweenState::GetLaneRate() const
+{
+	if (bPaused || !bStarted)
+	{
+		return 0.0f;
+	}
+	return bForward ? 1.0f : -1.0f;
+}
 
-		const float NormalizedAlpha = LocalDuration > 0.0f ? ElapsedTime / LocalDuration : 1.0f;
-		const float EasedAlpha = FCoreTweenEasing::Ease(LocalEasingType, NormalizedAlpha, LocalEasingParam);
+float FCoreTweenState::Ease(const float Alpha) const
+{
+	if (EasingType == ECoreTweenEasingType::Curve)
+	{
+		return EasingCurve ? EasingCurve->Sample(Alpha) : Alpha;
+	}
+	return FCoreTweenEasing::Ease(EasingType, Alpha, EasingParam);
+}
 
-		ApplyAllLocal(EasedAlpha);
+void FCoreTweenState::ApplyAll(const float EasedAlpha)
+{
+	if (!Applier || !Target || !Target->IsTargetValid())
+	{
+		return;
+	}
+	Applier(*this, EasedAlpha, ECoreTweenApplyPhase::All);
+}
 
-		const bool bLapComplete = bForward ? (ElapsedTime >= LocalDuration) : (ElapsedTime <= 0.0f);
-		if (bLapComplete)
-		{
-			if (bLocalPingPong)
-			{
-				bForward = !bForward;
-				if (!bForward)
-				{
-					continue;
-				}
-			}
-
-			if (LoopsRemaining > 0)
-			{
-				LoopsRemaining--;
-			}
-			if (LoopsRemaining == 0)
-			{
-				break;
-			}
-
-			ElapsedTime = 0.0f;
-			bForward = true;
-		}
+void FCoreTweenState::Reset()
+{
+	bForceComplete.store(false, std::memory_order_relaxed);
+	FlowState = nullptr;
+	TargetObject.Reset();
+	bFinished.store(false, std::memory_order_relaxed);
+	Handle.Invalidate();
+	bPaused = false;
+	Waiter = nullptr;
+
+	Target.Reset();
+	bPooledTarget = false;
+	Duration = 1.0f;
+	DelayRemaining = 0.0f;
+	EasingType = ECoreTweenEasingType::Linear;
+	EasingParam.Reset();
+	EasingCurve.Reset();
+	LoopsRemaining = 1;
+	bPingPong = false;
+	bForward = true;
+	bStarted = false;
+	TimeSource = ECoreTweenTimeSource::Unpaused;
+	BatchLane = INDEX_NONE;
+	LODPolicy = ECoreTweenLODPolicy::Default;
+	LODThrottleInterval = 0;
+	bRelevant = true;
+	Priority = ECoreTweenPriority::Normal;
+	DeferredFrames = 0;
+	bWritePending = false;
+	bFollow = false;
+	FollowOmega = 0.0f;
+	FollowDelta = 0.0f;
+	bCarryVelocity = false;
+	VelocityWeight = 0.0f;
+
+	Properties.Reset();
+
+	OnStartDelegate.Unbind();
+	OnCompleteDelegate.Unbind();
+	PropertyMask = ECoreTweenProperty::None;
+	Applier = nullptr;
+	DirtyMask = ECoreTweenProperty::None;
+	StepEvents = ECoreTweenStepEvents::None;
+}
+
+// ── Launch ──────────────────────────────────────────────────────────
+
+TSharedPtr<FCoreTweenState> FCoreTweenBuilder::MakeState(UObject* WorldContext)
+{
+	TSharedPtr<FCoreTweenState> TweenState = UCoreTween::AcquireTweenState(WorldContext);
+	MoveInto(*TweenState);
+	return TweenState;
+}
+
+void FCoreTweenBuilder::MoveInto(FCoreTweenState& TweenState)
+{
+	CopyConfigTo(TweenState);
+	TweenState.TargetObject = TargetObject;
+	TweenState.Target = MoveTemp(Target);
+	TweenState.bPooledTarget = bPooledTarget;
+	TweenState.OnStartDelegate = MoveTemp(OnStartDelegate);
+	TweenState.OnCompleteDelegate = MoveTemp(OnCompleteDelegate);
+	if (TweenState.Target)
+	{
+		TweenState.Target->OnTweenLaunched(TweenState);
 	}
+}
 
-	// Fire OnComplete callback
-	LocalOnCompleteDelegate.ExecuteIfBound();
-	TweenState->FlowState.Reset();
-	TweenState->bFinished.store(true, std::memory_order_release);
+void FCoreTweenBuilder::InitTrackState(FCoreTweenState& State) const
+{
+	CopyConfigTo(State);
+
+	// Tracks are sampled at arbitrary times, which a stateful spring cannot do.
+	State.bFollow = false;
+	State.OnStartDelegate = OnStartDelegate;
+	State.OnCompleteDelegate = OnCompleteDelegate;
 }
 
+void FCoreTweenBuilder::CopyConfigTo(FCoreTweenState& TweenState) const
+{
+	TweenState.Duration = Duration;
+	TweenState.DelayRemaining = Delay;
+	TweenState.EasingType = EasingType;
+	TweenState.EasingParam = EasingParam;
+	TweenState.EasingCurve = EasingCurveTable;
+	TweenState.LoopsRemaining = LoopCount;
+	TweenState.bPingPong = bPingPong;
+	TweenState.TimeSource = TimeSource;
+	TweenState.LODPolicy = LODPolicy;
+	TweenState.LODThrottleInterval = LODThrottleInterval;
+	TweenState.Priority = Priority;
+	TweenState.bFollow = bFollow;
+	TweenState.FollowOmega = bFollow ? 2.0f / FMath::Max(FollowSmoothTime, UE_KINDA_SMALL_NUMBER) : 0.0f;
+
+	TweenState.Properties = Properties;
+
+	TweenState.PropertyMask = TweenState.ComputePropertyMask();
+	if (StaticApplier && TweenState.PropertyMask == StaticPropertyMask)
+	{
+		TweenState.Applier = StaticApplier;
+	}
+	else
+	{
+		TweenState.Applier = CoreTweenApply::SelectApplier(TweenState.PropertyMask);
+	}
+}
+
+FCoreTweenHandle FCoreTweenBuilder::Start(UObject* WorldContext)
+{
+	return UCoreTween::RegisterTweenState(WorldContext, MakeState(WorldContext));
+}
+
+AsyncFlow::TTask<void> FCoreTweenBuilder::Run(UObject* WorldContext)
+{
+	// Move all builder state into the shared tween state before any suspension.
+	// The builder may be a temporary destroyed after the first co_await.
+	TSharedPtr<FCoreTweenState> TweenState = MakeState(WorldContext);
+
+	// Store flow state for external cancellation. The frame outlives the tween's use of it.
+	TweenState->FlowState = AsyncFlow::Private::GetCurrentFlowState();
+
+	// The subsystem applies the start values, then drives the tween from its batched tick.
+	if (!UCoreTween::RegisterTweenState(WorldContext, TweenState).IsValid())
+	{
+		co_return;
+	}
+
+	// Hand our reference to the awaiter so the state is uniquely owned by the
+	// subsystem once the awaiter dies, letting it go straight back to the pool.
+	co_await FCoreTweenCompletionAwaiter(MoveTemp(TweenState));
+}
@@ -0,0 +1,67 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "CoreTweenBuilder.h"
+
+/**
+ * Suspends a coroutine until UCoreTweenWorldSubsystem finishes the tween,
+ * whether it completes or is cancelled. The subsystem resumes the stored handle
+ * after its batched tick. Used by FCoreTweenBuilder::Run() and
+ * UCoreTween::WaitForCompletion(); a tween has room for one waiter.
+ * If the frame is destroyed while suspended (task cancelled or dropped),
+ * the destructor unhooks the handle and flow state so the subsystem never
+ * touches them again.
+ */
+struct FCoreTweenCompletionAwaiter
+{
+	TSharedPtr<FCoreTweenState> State;
+
+	explicit FCoreTweenCompletionAwaiter(TSharedPtr<FCoreTweenState> InState)
+		: State(MoveTemp(InState))
+	{
+	}
+
+	~FCoreTweenCompletionAwaiter()
+	{
+		if (State)
+		{
+			State->Waiter = nullptr;
+			State->FlowState = nullptr;
+		}
+	}
+
+	bool await_ready() const
+	{
+		return State->bFinished.load(std::memory_order_acquire);
+	}
+
+	void await_suspend(std::coroutine_handle<> Handle)
+	{
+		State->Waiter = Handle;
+	}
+
+	void await_resume() const
+	{
+	}
+};
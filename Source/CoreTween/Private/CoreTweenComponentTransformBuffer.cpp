@@ -0,0 +1,185 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CoreTweenComponentTransformBuffer.h"
+
+#include "Targets/CoreTweenTarget.h"
+#include "Components/SceneComponent.h"
+
+FCoreTweenComponentTransformBuffer* FCoreTweenComponentTransformBuffer::Active = nullptr;
+
+namespace
+{
+	/** Number of attach parents above Component. Parents flush first so children are only propagated once. */
+	int32 GetAttachDepth(const USceneComponent* Component)
+	{
+		int32 Depth = 0;
+		for (const USceneComponent* Parent = Component->GetAttachParent(); Parent; Parent = Parent->GetAttachParent())
+		{
+			++Depth;
+		}
+		return Depth;
+	}
+} // namespace
+
+FCoreTweenPendingComponentTransform& FCoreTweenComponentTransformBuffer::FindOrAdd(USceneComponent* Component, const ETeleportType Teleport)
+{
+	bool bAdded;
+	FCoreTweenPendingComponentTransform& Entry = FindOrAddEntry(Component, bAdded);
+	if (bAdded)
+	{
+		Entry.Component = Component;
+		Entry.Teleport = Teleport;
+		Entry.AttachDepth = GetAttachDepth(Component);
+	}
+	// Any teleporting tween on the component makes the combined write a teleport.
+	else if (Teleport != ETeleportType::None)
+	{
+		Entry.Teleport = Teleport;
+	}
+	return Entry;
+}
+
+void FCoreTweenComponentTransformBuffer::MergeWorld(USceneComponent* Component, const FCoreTweenWorldTransform& Value, const ETeleportType Teleport)
+{
+	if (!Component || Value.Components == ECoreTweenProperty::None)
+	{
+		return;
+	}
+
+	FCoreTweenPendingComponentTransform& Entry = FindOrAdd(Component, Teleport);
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Location))
+	{
+		Entry.Location = Value.Location;
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Orientation))
+	{
+		Entry.Rotation = Value.Rotation;
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Scale3D))
+	{
+		Entry.Scale3D = Value.Scale3D;
+	}
+	Entry.WorldComponents |= Value.Components;
+}
+
+void FCoreTweenComponentTransformBuffer::MergeRelative(USceneComponent* Component, const FTransform& Value, const ETeleportType Teleport)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	FindOrAdd(Component, Teleport).Relative = Value;
+}
+
+void FCoreTweenComponentTransformBuffer::WriteWorld(USceneComponent* Component, const FCoreTweenWorldTransform& Value, const ETeleportType Teleport)
+{
+	if (!Component || Value.Components == ECoreTweenProperty::None)
+	{
+		return;
+	}
+
+	FTransform Transform = Component->GetComponentTransform();
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Location))
+	{
+		Transform.SetLocation(Value.Location);
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Orientation))
+	{
+		Transform.SetRotation(Value.Rotation);
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Scale3D))
+	{
+		Transform.SetScale3D(Value.Scale3D);
+	}
+	Component->SetWorldTransform(Transform, false, nullptr, Teleport);
+}
+
+bool FCoreTweenComponentTransformBuffer::Find(const USceneComponent* Component, FTransform& OutWorld, FTransform& OutRelative) const
+{
+	const FCoreTweenPendingComponentTransform* PendingEntry = FindEntry(Component);
+	if (!PendingEntry)
+	{
+		return false;
+	}
+	const FCoreTweenPendingComponentTransform& Entry = *PendingEntry;
+
+	// The parent as it is now. Its own pending write, if any, is not composed in.
+	const USceneComponent* Parent = Component->GetAttachParent();
+	const FTransform ParentToWorld = Parent ? Parent->GetSocketTransform(Component->GetAttachSocketName()) : FTransform::Identity;
+
+	// Same order as Flush(): the relative write first, then the world components over it.
+	OutRelative = Entry.Relative.IsSet() ? Entry.Relative.GetValue() : Component->GetRelativeTransform();
+	OutWorld = Entry.Relative.IsSet() ? OutRelative * ParentToWorld : Component->GetComponentTransform();
+
+	if (Entry.WorldComponents != ECoreTweenProperty::None)
+	{
+		if (EnumHasAnyFlags(Entry.WorldComponents, ECoreTweenProperty::Location))
+		{
+			OutWorld.SetLocation(Entry.Location);
+		}
+		if (EnumHasAnyFlags(Entry.WorldComponents, ECoreTweenProperty::Orientation))
+		{
+			OutWorld.SetRotation(Entry.Rotation);
+		}
+		if (EnumHasAnyFlags(Entry.WorldComponents, ECoreTweenProperty::Scale3D))
+		{
+			OutWorld.SetScale3D(Entry.Scale3D);
+		}
+		OutRelative = OutWorld.GetRelativeTransform(ParentToWorld);
+	}
+	return true;
+}
+
+void FCoreTweenComponentTransformBuffer::Flush()
+{
+	if (Entries.Num() > 1)
+	{
+		Entries.StableSort([](const FCoreTweenPendingComponentTransform& A, const FCoreTweenPendingComponentTransform& B) { return A.AttachDepth < B.AttachDepth; });
+	}
+
+	for (const FCoreTweenPendingComponentTransform& Entry : Entries)
+	{
+		USceneComponent* Component = Entry.Component.Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		if (Entry.Relative.IsSet())
+		{
+			Component->SetRelativeTransform(Entry.Relative.GetValue(), false, nullptr, Entry.Teleport);
+		}
+
+		if (Entry.WorldComponents != ECoreTweenProperty::None)
+		{
+			FCoreTweenWorldTransform World;
+			World.Location = Entry.Location;
+			World.Rotation = Entry.Rotation;
+			World.Scale3D = Entry.Scale3D;
+			World.Components = Entry.WorldComponents;
+			WriteWorld(Component, World, Entry.Teleport);
+		}
+	}
+	ResetEntries();
+}
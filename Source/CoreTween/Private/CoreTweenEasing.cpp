@@ -22,9 +22,130 @@
 
 #include "CoreTweenEasing.h"
 
+#include "CoreTweenEasingLUT.h"
+#include "HAL/IConsoleManager.h"
 #include "Math/UnrealMathUtility.h"
+#include "Math/VectorRegister.h"
+#include "Templates/SharedPointer.h"
+
+// ── LUT mode ────────────────────────────────────────────────────────
+
+namespace
+{
+	int32 GCoreTweenEasingLUTResolution = 0;
+
+	/** Baked tables, indexed by easing type. Swapped on the game thread only, between ticks. */
+	TSharedPtr<const FCoreTweenEasingLUT> GEasingLUTs[FCoreTweenEasing::NumEasingTypes];
+
+	bool IsTabulated(const ECoreTweenEasingType Type)
+	{
+		switch (Type)
+		{
+			case ECoreTweenEasingType::EaseInExpo:
+			case ECoreTweenEasingType::EaseOutExpo:
+			case ECoreTweenEasingType::EaseInOutExpo:
+			case ECoreTweenEasingType::EaseInSine:
+			case ECoreTweenEasingType::EaseOutSine:
+			case ECoreTweenEasingType::EaseInOutSine:
+			case ECoreTweenEasingType::EaseInElastic:
+			case ECoreTweenEasingType::EaseOutElastic:
+			case ECoreTweenEasingType::EaseInOutElastic:
+			case ECoreTweenEasingType::Spring:
+				return true;
+
+			default:
+				return false;
+		}
+	}
+
+	void BakeEasingLUTs()
+	{
+		for (int32 TypeIdx = 0; TypeIdx < FCoreTweenEasing::NumEasingTypes; ++TypeIdx)
+		{
+			const ECoreTweenEasingType Type = static_cast<ECoreTweenEasingType>(TypeIdx);
+			GEasingLUTs[TypeIdx].Reset();
+			if (GCoreTweenEasingLUTResolution > 0 && IsTabulated(Type))
+			{
+				GEasingLUTs[TypeIdx] = FCoreTweenEasingLUT::Bake(
+					[Type](const float Alpha) { return FCoreTweenEasing::EaseAnalytic(Type, Alpha); },
+					GCoreTweenEasingLUTResolution);
+			}
+		}
+	}
+
+	FAutoConsoleVariableRef CVarCoreTweenEasingLUTResolution(
+		TEXT("CoreTween.EasingLUTResolution"),
+		GCoreTweenEasingLUTResolution,
+		TEXT("Segments per baked easing table for Expo, Sine, Elastic and Spring. 0 evaluates them analytically."),
+		FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*) { BakeEasingLUTs(); }),
+		ECVF_Default);
+
+	/** Sample Table for lanes with the default parameter; the rest fall back to the analytic curve. */
+	void RunLUTKernel(const FCoreTweenEasingLUT& Table, const ECoreTweenEasingType Type, float* InOutAlpha, const float* Params, const int32 Num)
+	{
+		const float DefaultParam = FCoreTweenEasing::GetDefaultParam(Type);
+		for (int32 Idx = 0; Idx < Num; ++Idx)
+		{
+			InOutAlpha[Idx] = Params[Idx] == DefaultParam
+				? Table.Sample(InOutAlpha[Idx])
+				: FCoreTweenEasing::EaseAnalytic(Type, InOutAlpha[Idx], Params[Idx]);
+		}
+	}
+} // namespace
+
+void FCoreTweenEasing::SetLUTResolution(const int32 Resolution)
+{
+	CVarCoreTweenEasingLUTResolution->Set(FMath::Max(Resolution, 0), ECVF_SetByCode);
+}
+
+int32 FCoreTweenEasing::GetLUTResolution()
+{
+	return GCoreTweenEasingLUTResolution;
+}
+
+const FCoreTweenEasingLUT* FCoreTweenEasing::GetLUT(const ECoreTweenEasingType Type)
+{
+	const int32 TypeIdx = static_cast<int32>(Type);
+	return TypeIdx < NumEasingTypes ? GEasingLUTs[TypeIdx].Get() : nullptr;
+}
+
+// ── Dispatch ────────────────────────────────────────────────────────
+
+float FCoreTweenEasing::GetDefaultParam(const ECoreTweenEasingType Type)
+{
+	switch (Type)
+	{
+		case ECoreTweenEasingType::EaseInBack:
+		case ECoreTweenEasingType::EaseOutBack:
+		case ECoreTweenEasingType::EaseInOutBack:
+			return 1.70158f;
+
+		case ECoreTweenEasingType::EaseInElastic:
+		case ECoreTweenEasingType::EaseOutElastic:
+		case ECoreTweenEasingType::EaseInOutElastic:
+			return 1.0f;
+
+		case ECoreTweenEasingType::Spring:
+			return 0.5f;
+
+		default:
+			return 0.0f;
+	}
+}
 
 float FCoreTweenEasing::Ease(const ECoreTweenEasingType Type, const float Alpha, const TOptional<float> Param)
+{
+	if (const FCoreTweenEasingLUT* Table = GetLUT(Type))
+	{
+		if (!Param.IsSet() || Param.GetValue() == GetDefaultParam(Type))
+		{
+			return Table->Sample(Alpha);
+		}
+	}
+	return EaseAnalytic(Type, Alpha, Param);
+}
+
+float FCoreTweenEasing::EaseAnalytic(const ECoreTweenEasingType Type, const float Alpha, const TOptional<float> Param)
 {
 	switch (Type)
 	{
@@ -77,6 +198,172 @@ float FCoreTweenEasing::Ease(const ECoreTweenEasingType Type, const float Alpha,
 	}
 }
 
+// ── Batch kernels ───────────────────────────────────────────────────
+
+namespace
+{
+	template <int32 N>
+	FORCEINLINE VectorRegister4Float VectorPowN(const VectorRegister4Float& V)
+	{
+		VectorRegister4Float Result = V;
+		for (int32 Idx = 1; Idx < N; ++Idx)
+		{
+			Result = VectorMultiply(Result, V);
+		}
+		return Result;
+	}
+
+	/** A^N */
+	template <int32 N>
+	FORCEINLINE VectorRegister4Float VectorEaseIn(const VectorRegister4Float& Alpha)
+	{
+		return VectorPowN<N>(Alpha);
+	}
+
+	/** 1 - (1 - A)^N, written in the same (A - 1) form as the scalar functions. */
+	template <int32 N>
+	FORCEINLINE VectorRegister4Float VectorEaseOut(const VectorRegister4Float& Alpha)
+	{
+		const VectorRegister4Float Shifted = VectorSubtract(Alpha, GlobalVectorConstants::FloatOne);
+		const VectorRegister4Float Powered = VectorPowN<N>(Shifted);
+		return (N % 2 == 1)
+			? VectorAdd(Powered, GlobalVectorConstants::FloatOne)
+			: VectorSubtract(GlobalVectorConstants::FloatOne, Powered);
+	}
+
+	/** Both halves are evaluated and merged with a mask instead of branching per lane. */
+	template <int32 N>
+	FORCEINLINE VectorRegister4Float VectorEaseInOut(const VectorRegister4Float& Alpha)
+	{
+		const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+		const VectorRegister4Float T = VectorAdd(Alpha, Alpha);
+		const VectorRegister4Float Low = VectorMultiply(Half, VectorPowN<N>(T));
+
+		const VectorRegister4Float Shifted = VectorSubtract(T, VectorSetFloat1(2.0f));
+		const VectorRegister4Float HighScale = VectorSetFloat1((N % 2 == 1) ? 0.5f : -0.5f);
+		const VectorRegister4Float High = VectorMultiplyAdd(HighScale, VectorPowN<N>(Shifted), GlobalVectorConstants::FloatOne);
+
+		return VectorSelect(VectorCompareLT(T, GlobalVectorConstants::FloatOne), Low, High);
+	}
+
+	/** Run a vector kernel over InOutAlpha; the ragged tail is padded into a scratch register. */
+	using FVectorKernel = VectorRegister4Float (*)(const VectorRegister4Float&);
+	using FScalarKernel = float (*)(float);
+	using FScalarParamKernel = float (*)(float, float);
+
+	template <FVectorKernel Kernel>
+	void RunVectorKernel(float* InOutAlpha, const int32 Num)
+	{
+		int32 Idx = 0;
+		for (; Idx + 4 <= Num; Idx += 4)
+		{
+			VectorStore(Kernel(VectorLoad(InOutAlpha + Idx)), InOutAlpha + Idx);
+		}
+
+		const int32 Remaining = Num - Idx;
+		if (Remaining > 0)
+		{
+			alignas(16) float Scratch[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			FMemory::Memcpy(Scratch, InOutAlpha + Idx, Remaining * sizeof(float));
+			VectorStoreAligned(Kernel(VectorLoadAligned(Scratch)), Scratch);
+			FMemory::Memcpy(InOutAlpha + Idx, Scratch, Remaining * sizeof(float));
+		}
+	}
+
+	template <FScalarKernel Func>
+	void RunScalarKernel(float* InOutAlpha, const int32 Num)
+	{
+		for (int32 Idx = 0; Idx < Num; ++Idx)
+		{
+			InOutAlpha[Idx] = Func(InOutAlpha[Idx]);
+		}
+	}
+
+	template <FScalarParamKernel Func>
+	void RunScalarParamKernel(float* InOutAlpha, const float* Params, const int32 Num)
+	{
+		for (int32 Idx = 0; Idx < Num; ++Idx)
+		{
+			InOutAlpha[Idx] = Func(InOutAlpha[Idx], Params[Idx]);
+		}
+	}
+} // namespace
+
+void FCoreTweenEasing::EaseBatch(const ECoreTweenEasingType Type, float* InOutAlpha, const float* Params, const int32 Num)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	if (const FCoreTweenEasingLUT* Table = GetLUT(Type))
+	{
+		RunLUTKernel(*Table, Type, InOutAlpha, Params, Num);
+		return;
+	}
+
+	switch (Type)
+	{
+		case ECoreTweenEasingType::Linear: return;
+
+		case ECoreTweenEasingType::EaseInQuad:    RunVectorKernel<&VectorEaseIn<2>>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseOutQuad:   RunVectorKernel<&VectorEaseOut<2>>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseInOutQuad: RunVectorKernel<&VectorEaseInOut<2>>(InOutAlpha, Num); return;
+
+		case ECoreTweenEasingType::EaseInCubic:    RunVectorKernel<&VectorEaseIn<3>>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseOutCubic:   RunVectorKernel<&VectorEaseOut<3>>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseInOutCubic: RunVectorKernel<&VectorEaseInOut<3>>(InOutAlpha, Num); return;
+
+		case ECoreTweenEasingType::EaseInQuart:    RunVectorKernel<&VectorEaseIn<4>>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseOutQuart:   RunVectorKernel<&VectorEaseOut<4>>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseInOutQuart: RunVectorKernel<&VectorEaseInOut<4>>(InOutAlpha, Num); return;
+
+		case ECoreTweenEasingType::EaseInQuint:    RunVectorKernel<&VectorEaseIn<5>>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseOutQuint:   RunVectorKernel<&VectorEaseOut<5>>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseInOutQuint: RunVectorKernel<&VectorEaseInOut<5>>(InOutAlpha, Num); return;
+
+		case ECoreTweenEasingType::EaseInExpo:    RunScalarKernel<&InExpo>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseOutExpo:   RunScalarKernel<&OutExpo>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseInOutExpo: RunScalarKernel<&InOutExpo>(InOutAlpha, Num); return;
+
+		case ECoreTweenEasingType::EaseInSine:    RunScalarKernel<&InSine>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseOutSine:   RunScalarKernel<&OutSine>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseInOutSine: RunScalarKernel<&InOutSine>(InOutAlpha, Num); return;
+
+		case ECoreTweenEasingType::EaseInCirc:    RunScalarKernel<&InCirc>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseOutCirc:   RunScalarKernel<&OutCirc>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseInOutCirc: RunScalarKernel<&InOutCirc>(InOutAlpha, Num); return;
+
+		case ECoreTweenEasingType::EaseInBack:    RunScalarParamKernel<&InBack>(InOutAlpha, Params, Num); return;
+		case ECoreTweenEasingType::EaseOutBack:   RunScalarParamKernel<&OutBack>(InOutAlpha, Params, Num); return;
+		case ECoreTweenEasingType::EaseInOutBack: RunScalarParamKernel<&InOutBack>(InOutAlpha, Params, Num); return;
+
+		case ECoreTweenEasingType::EaseInElastic:    RunScalarParamKernel<&InElastic>(InOutAlpha, Params, Num); return;
+		case ECoreTweenEasingType::EaseOutElastic:   RunScalarParamKernel<&OutElastic>(InOutAlpha, Params, Num); return;
+		case ECoreTweenEasingType::EaseInOutElastic: RunScalarParamKernel<&InOutElastic>(InOutAlpha, Params, Num); return;
+
+		case ECoreTweenEasingType::EaseInBounce:    RunScalarKernel<&InBounce>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseOutBounce:   RunScalarKernel<&OutBounce>(InOutAlpha, Num); return;
+		case ECoreTweenEasingType::EaseInOutBounce: RunScalarKernel<&InOutBounce>(InOutAlpha, Num); return;
+
+		case ECoreTweenEasingType::Spring: RunScalarParamKernel<&SpringEase>(InOutAlpha, Params, Num); return;
+
+		default:
+			return;
+	}
+}
+
+void FCoreTweenEasing::EaseCurveBatch(const FCoreTweenEasingLUT* const* Curves, float* InOutAlpha, const int32 Num)
+{
+	for (int32 Idx = 0; Idx < Num; ++Idx)
+	{
+		if (Curves[Idx])
+		{
+			InOutAlpha[Idx] = Curves[Idx]->Sample(InOutAlpha[Idx]);
+		}
+	}
+}
+
 // ── Linear ──────────────────────────────────────────────────────────
 
 float FCoreTweenEasing::Linear(const float Alpha)
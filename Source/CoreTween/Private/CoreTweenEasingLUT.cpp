@@ -0,0 +1,130 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CoreTweenEasingLUT.h"
+
+#include "Curves/CurveFloat.h"
+#include "UObject/ObjectKey.h"
+
+TSharedRef<const FCoreTweenEasingLUT> FCoreTweenEasingLUT::Bake(const TFunctionRef<float(float)> Func, const int32 Resolution)
+{
+	TSharedRef<FCoreTweenEasingLUT> Table = MakeShared<FCoreTweenEasingLUT>();
+	Table->Resolution = FMath::Max(Resolution, 1);
+	Table->Scale = static_cast<float>(Table->Resolution);
+	Table->Samples.SetNumUninitialized(Table->Resolution + 1);
+	for (int32 Idx = 0; Idx <= Table->Resolution; ++Idx)
+	{
+		Table->Samples[Idx] = Func(static_cast<float>(Idx) / Table->Scale);
+	}
+	return Table;
+}
+
+TSharedRef<const FCoreTweenEasingLUT> FCoreTweenEasingLUT::FromCurve(const UCurveFloat* Curve, const int32 Resolution)
+{
+	if (!Curve)
+	{
+		return Bake([](const float Alpha) { return Alpha; }, 1);
+	}
+
+#if !WITH_EDITOR
+	// Game thread only, like the tween builders that call it.
+	static TMap<TPair<TObjectKey<UCurveFloat>, int32>, TSharedRef<const FCoreTweenEasingLUT>> Cache;
+	const TPair<TObjectKey<UCurveFloat>, int32> Key(Curve, Resolution);
+	if (const TSharedRef<const FCoreTweenEasingLUT>* Cached = Cache.Find(Key))
+	{
+		return *Cached;
+	}
+#endif
+
+	float MinTime = 0.0f;
+	float MaxTime = 0.0f;
+	Curve->GetTimeRange(MinTime, MaxTime);
+	if (MaxTime <= MinTime)
+	{
+		MinTime = 0.0f;
+		MaxTime = 1.0f;
+	}
+
+	TSharedRef<const FCoreTweenEasingLUT> Table = Bake(
+		[Curve, MinTime, MaxTime](const float Alpha) { return Curve->GetFloatValue(FMath::Lerp(MinTime, MaxTime, Alpha)); },
+		Resolution);
+
+#if !WITH_EDITOR
+	Cache.Add(Key, Table);
+#endif
+	return Table;
+}
+
+TSharedRef<const FCoreTweenEasingLUT> FCoreTweenEasingLUT::FromCubicBezier(float X1, const float Y1, float X2, const float Y2, const int32 Resolution)
+{
+	X1 = FMath::Clamp(X1, 0.0f, 1.0f);
+	X2 = FMath::Clamp(X2, 0.0f, 1.0f);
+
+	// B(t) = 3(1-t)^2 t P1 + 3(1-t) t^2 P2 + t^3, per axis.
+	auto Bezier = [](const float T, const float P1, const float P2)
+	{
+		const float U = 1.0f - T;
+		return 3.0f * U * U * T * P1 + 3.0f * U * T * T * P2 + T * T * T;
+	};
+	auto BezierSlope = [](const float T, const float P1, const float P2)
+	{
+		const float U = 1.0f - T;
+		return 3.0f * U * U * P1 + 6.0f * U * T * (P2 - P1) + 3.0f * T * T * (1.0f - P2);
+	};
+
+	return Bake(
+		[=](const float Alpha)
+		{
+			// X(t) is monotonic with X1, X2 in [0, 1]: Newton steps, falling back to bisection on flat slopes.
+			float T = Alpha;
+			for (int32 Iteration = 0; Iteration < 8; ++Iteration)
+			{
+				const float Error = Bezier(T, X1, X2) - Alpha;
+				const float Slope = BezierSlope(T, X1, X2);
+				if (FMath::Abs(Error) < 1e-6f || FMath::Abs(Slope) < 1e-6f)
+				{
+					break;
+				}
+				T = FMath::Clamp(T - Error / Slope, 0.0f, 1.0f);
+			}
+
+			if (FMath::Abs(Bezier(T, X1, X2) - Alpha) >= 1e-5f)
+			{
+				float Low = 0.0f;
+				float High = 1.0f;
+				for (int32 Iteration = 0; Iteration < 32; ++Iteration)
+				{
+					T = 0.5f * (Low + High);
+					if (Bezier(T, X1, X2) < Alpha)
+					{
+						Low = T;
+					}
+					else
+					{
+						High = T;
+					}
+				}
+			}
+			return Bezier(T, Y1, Y2);
+		},
+		Resolution);
+}
@@ -0,0 +1,151 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CoreTweenMaterialParameterBuffer.h"
+
+#include "Materials/MaterialInstanceDynamic.h"
+
+FCoreTweenMaterialParameterBuffer* FCoreTweenMaterialParameterBuffer::Active = nullptr;
+
+namespace
+{
+	/** Overwrite the pending write for ParameterIndex, or append one. A MID rarely has more than a few tweened parameters. */
+	template <typename WriteArrayType, typename ValueType>
+	void MergeWrite(WriteArrayType& Writes, const int32 ParameterIndex, const FName ParameterName, const ValueType& Value)
+	{
+		for (auto& Write : Writes)
+		{
+			if (Write.ParameterIndex == ParameterIndex && Write.ParameterName == ParameterName)
+			{
+				Write.Value = Value;
+				return;
+			}
+		}
+		Writes.Add({ParameterIndex, ParameterName, Value});
+	}
+
+	/** Value of the pending write to ParameterName, or nullptr. Matched by name: each target caches its own index. */
+	template <typename ValueType, typename WriteArrayType>
+	const ValueType* FindWrite(const WriteArrayType& Writes, const FName ParameterName)
+	{
+		for (const auto& Write : Writes)
+		{
+			if (Write.ParameterName == ParameterName)
+			{
+				return &Write.Value;
+			}
+		}
+		return nullptr;
+	}
+} // namespace
+
+FCoreTweenPendingMaterialParameters& FCoreTweenMaterialParameterBuffer::FindOrAdd(UMaterialInstanceDynamic* Material)
+{
+	bool bAdded;
+	FCoreTweenPendingMaterialParameters& Entry = FindOrAddEntry(Material, bAdded);
+	if (bAdded)
+	{
+		Entry.Material = Material;
+	}
+	return Entry;
+}
+
+void FCoreTweenMaterialParameterBuffer::MergeScalar(UMaterialInstanceDynamic* Material, const int32 ParameterIndex, const FName ParameterName, const float Value)
+{
+	if (!Material)
+	{
+		return;
+	}
+
+	MergeWrite(FindOrAdd(Material).Scalars, ParameterIndex, ParameterName, Value);
+}
+
+void FCoreTweenMaterialParameterBuffer::MergeVector(UMaterialInstanceDynamic* Material, const int32 ParameterIndex, const FName ParameterName, const FLinearColor& Value)
+{
+	if (!Material)
+	{
+		return;
+	}
+
+	MergeWrite(FindOrAdd(Material).Vectors, ParameterIndex, ParameterName, Value);
+}
+
+const float* FCoreTweenMaterialParameterBuffer::FindScalar(const UMaterialInstanceDynamic* Material, const FName ParameterName) const
+{
+	const FCoreTweenPendingMaterialParameters* Entry = FindEntry(Material);
+	return Entry ? FindWrite<float>(Entry->Scalars, ParameterName) : nullptr;
+}
+
+const FLinearColor* FCoreTweenMaterialParameterBuffer::FindVector(const UMaterialInstanceDynamic* Material, const FName ParameterName) const
+{
+	const FCoreTweenPendingMaterialParameters* Entry = FindEntry(Material);
+	return Entry ? FindWrite<FLinearColor>(Entry->Vectors, ParameterName) : nullptr;
+}
+
+void FCoreTweenMaterialParameterBuffer::WriteScalar(UMaterialInstanceDynamic* Material, const int32 ParameterIndex, const FName ParameterName, const float Value)
+{
+	if (!Material)
+	{
+		return;
+	}
+
+	// The index only stops resolving if the instance's parameters were cleared; fall back to the name lookup.
+	if (ParameterIndex == INDEX_NONE || !Material->SetScalarParameterByIndex(ParameterIndex, Value))
+	{
+		Material->SetScalarParameterValue(ParameterName, Value);
+	}
+}
+
+void FCoreTweenMaterialParameterBuffer::WriteVector(UMaterialInstanceDynamic* Material, const int32 ParameterIndex, const FName ParameterName, const FLinearColor& Value)
+{
+	if (!Material)
+	{
+		return;
+	}
+
+	if (ParameterIndex == INDEX_NONE || !Material->SetVectorParameterByIndex(ParameterIndex, Value))
+	{
+		Material->SetVectorParameterValue(ParameterName, Value);
+	}
+}
+
+void FCoreTweenMaterialParameterBuffer::Flush()
+{
+	for (const FCoreTweenPendingMaterialParameters& Entry : Entries)
+	{
+		UMaterialInstanceDynamic* Material = Entry.Material.Get();
+		if (!Material)
+		{
+			continue;
+		}
+
+		for (const TCoreTweenPendingMaterialParameter<float>& Write : Entry.Scalars)
+		{
+			WriteScalar(Material, Write.ParameterIndex, Write.ParameterName, Write.Value);
+		}
+		for (const TCoreTweenPendingMaterialParameter<FLinearColor>& Write : Entry.Vectors)
+		{
+			WriteVector(Material, Write.ParameterIndex, Write.ParameterName, Write.Value);
+		}
+	}
+	ResetEntries();
+}
@@ -0,0 +1,75 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CoreTweenRenderTransformBuffer.h"
+
+#include "Targets/CoreTweenTarget.h"
+#include "Components/Widget.h"
+
+FCoreTweenRenderTransformBuffer* FCoreTweenRenderTransformBuffer::Active = nullptr;
+
+void FCoreTweenRenderTransformBuffer::Merge(UWidget* Widget, const FCoreTweenRenderTransform& Value)
+{
+	if (!Widget)
+	{
+		return;
+	}
+
+	bool bAdded;
+	FCoreTweenPendingRenderTransform* Entry = &FindOrAddEntry(Widget, bAdded);
+	if (bAdded)
+	{
+		Entry->Widget = Widget;
+		Entry->Transform = Widget->GetRenderTransform();
+	}
+
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Translation))
+	{
+		Entry->Transform.Translation = Value.Translation;
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Scale))
+	{
+		Entry->Transform.Scale = Value.Scale;
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Rotation))
+	{
+		Entry->Transform.Angle = Value.Angle;
+	}
+}
+
+const FWidgetTransform* FCoreTweenRenderTransformBuffer::Find(const UWidget* Widget) const
+{
+	const FCoreTweenPendingRenderTransform* Entry = FindEntry(Widget);
+	return Entry ? &Entry->Transform : nullptr;
+}
+
+void FCoreTweenRenderTransformBuffer::Flush()
+{
+	for (const FCoreTweenPendingRenderTransform& Entry : Entries)
+	{
+		if (UWidget* Widget = Entry.Widget.Get())
+		{
+			Widget->SetRenderTransform(Entry.Transform);
+		}
+	}
+	ResetEntries();
+}
@@ -22,6 +22,128 @@
 
 #include "CoreTweenSequence.h"
 
+#include "CoreTween.h"
+#include "CoreTweenTimeline.h"
+
+// ── FPlayer ─────────────────────────────────────────────────────────
+
+/**
+ * Runtime side of a sequence. It is the target of one property-less, linear
+ * driver tween lasting the whole sequence. The driver's applier hands it the
+ * sequence clock, and it launches the steps and fires the callbacks that
+ * clock has passed. That happens after the pass has flushed its write
+ * buffers, so a step animating from the current value starts where the
+ * previous step left the target.
+ */
+class FCoreTweenSequence::FPlayer final : public ICoreTweenTarget
+{
+public:
+	FPlayer(UObject* InWorldContext, TArray<FStep>&& InSteps, TArray<FCallback>&& InCallbacks)
+		: WorldContext(InWorldContext)
+		, Steps(MoveTemp(InSteps))
+		, Callbacks(MoveTemp(InCallbacks))
+	{
+		Steps.StableSort([](const FStep& A, const FStep& B) { return A.StartTime < B.StartTime; });
+		Callbacks.StableSort([](const FCallback& A, const FCallback& B) { return A.Time < B.Time; });
+		Launched.Reserve(Steps.Num());
+	}
+
+	virtual bool IsTargetValid() const override
+	{
+		return WorldContext.IsValid();
+	}
+
+	virtual void OnTweenCancelled() override
+	{
+		bCancelled = true;
+		UObject* Context = WorldContext.Get();
+		for (const FCoreTweenHandle& Handle : Launched)
+		{
+			UCoreTween::Cancel(Context, Handle);
+		}
+		Launched.Reset();
+	}
+
+	/** Applier of the driver tween. The driver is linear, so its alpha maps straight back to sequence time. */
+	static void Apply(FCoreTweenState& State, const float EasedAlpha, const ECoreTweenApplyPhase Phase)
+	{
+		FPlayer& Player = static_cast<FPlayer&>(*State.Target);
+		if (EnumHasAnyFlags(Phase, ECoreTweenApplyPhase::Evaluate))
+		{
+			Player.PendingTime = EasedAlpha * State.Duration;
+		}
+		if (EnumHasAnyFlags(Phase, ECoreTweenApplyPhase::Write))
+		{
+			Player.bPendingForceComplete |= State.bForceComplete.load(std::memory_order_acquire);
+
+			// Fixed-step catch-up writes several times a pass; one queued advance to the latest time covers them all.
+			if (!Player.bAdvanceQueued)
+			{
+				Player.bAdvanceQueued = true;
+				TWeakPtr<FPlayer> WeakPlayer = StaticCastSharedPtr<FPlayer>(State.Target);
+				UCoreTween::LaunchAfterFlush(Player.WorldContext.Get(), [WeakPlayer]()
+				{
+					if (const TSharedPtr<FPlayer> QueuedPlayer = WeakPlayer.Pin())
+					{
+						QueuedPlayer->bAdvanceQueued = false;
+						QueuedPlayer->AdvanceTo(QueuedPlayer->PendingTime, QueuedPlayer->bPendingForceComplete);
+					}
+				});
+			}
+		}
+	}
+
+private:
+	/** Launch every step and fire every callback at or before Time, in time order. */
+	void AdvanceTo(const float Time, const bool bForceComplete)
+	{
+		UObject* Context = WorldContext.Get();
+		while (!bCancelled)
+		{
+			const float StepTime = Steps.IsValidIndex(NextStep) ? Steps[NextStep].StartTime : TNumericLimits<float>::Max();
+			const float CallbackTime = Callbacks.IsValidIndex(NextCallback) ? Callbacks[NextCallback].Time : TNumericLimits<float>::Max();
+			if (FMath::Min(StepTime, CallbackTime) > Time)
+			{
+				break;
+			}
+
+			if (CallbackTime <= StepTime)
+			{
+				Callbacks[NextCallback++].Callback.ExecuteIfBound();
+				continue;
+			}
+
+			// Carry the part of this frame that is already past the step's start as a negative delay.
+			FStep& Step = Steps[NextStep++];
+			Step.Builder.SetDelay(Step.Builder.GetDelay() - (Time - Step.StartTime));
+			Launched.Add(Step.Builder.Start(Context));
+		}
+
+		if (bForceComplete && !bCancelled)
+		{
+			for (const FCoreTweenHandle& Handle : Launched)
+			{
+				UCoreTween::Complete(Context, Handle);
+			}
+		}
+	}
+
+	TWeakObjectPtr<UObject> WorldContext;
+	TArray<FStep> Steps;
+	TArray<FCallback> Callbacks;
+	TArray<FCoreTweenHandle> Launched;
+	int32 NextStep = 0;
+	int32 NextCallback = 0;
+
+	/** Sequence time from the evaluate phase, consumed by the queued advance. */
+	float PendingTime = 0.0f;
+	bool bPendingForceComplete = false;
+	bool bAdvanceQueued = false;
+	bool bCancelled = false;
+};
+
+// ── FCoreTweenSequence ──────────────────────────────────────────────
+
 FCoreTweenSequence FCoreTweenSequence::Create()
 {
 	return FCoreTweenSequence();
@@ -29,16 +151,90 @@ FCoreTweenSequence FCoreTweenSequence::Create()
 
 FCoreTweenSequence& FCoreTweenSequence::Then(FCoreTweenBuilder InBuilder)
 {
-	Steps.Add(MoveTemp(InBuilder));
+	return Insert(Duration, MoveTemp(InBuilder));
+}
+
+FCoreTweenSequence& FCoreTweenSequence::Append(FCoreTweenBuilder InBuilder)
+{
+	return Insert(Duration, MoveTemp(InBuilder));
+}
+
+FCoreTweenSequence& FCoreTweenSequence::Join(FCoreTweenBuilder InBuilder)
+{
+	return Insert(LastStartTime, MoveTemp(InBuilder));
+}
+
+FCoreTweenSequence& FCoreTweenSequence::Insert(const float Time, FCoreTweenBuilder InBuilder)
+{
+	const float StartTime = FMath::Max(Time, 0.0f);
+	Duration = FMath::Max(Duration, StartTime + InBuilder.GetTotalDuration());
+	LastStartTime = StartTime;
+	Steps.Add({MoveTemp(InBuilder), StartTime});
+	return *this;
+}
+
+FCoreTweenSequence& FCoreTweenSequence::AppendInterval(const float Seconds)
+{
+	Duration += FMath::Max(Seconds, 0.0f);
+	return *this;
+}
+
+FCoreTweenSequence& FCoreTweenSequence::AppendCallback(FCoreTweenSignature Callback)
+{
+	return InsertCallback(Duration, MoveTemp(Callback));
+}
+
+FCoreTweenSequence& FCoreTweenSequence::InsertCallback(const float Time, FCoreTweenSignature Callback)
+{
+	const float CallbackTime = FMath::Max(Time, 0.0f);
+	Duration = FMath::Max(Duration, CallbackTime);
+	Callbacks.Add({MoveTemp(Callback), CallbackTime});
+	return *this;
+}
+
+FCoreTweenSequence& FCoreTweenSequence::SetTimeSource(const ECoreTweenTimeSource Source)
+{
+	TimeSource = Source;
 	return *this;
 }
 
+FCoreTweenBuilder FCoreTweenSequence::MakeDriver(UObject* WorldContext)
+{
+	TSharedRef<FPlayer> Player = MakeShared<FPlayer>(WorldContext, MoveTemp(Steps), MoveTemp(Callbacks));
+
+	// Additive with no target object: the driver is never hit by Clear() on a step's widget.
+	FCoreTweenBuilder Driver(Player, nullptr, Duration, 0.0f, true);
+	Driver.SetTimeSource(TimeSource);
+	Driver.WithStaticApplier(ECoreTweenProperty::None, &FPlayer::Apply);
+	Driver.SetLODPolicy(ECoreTweenLODPolicy::AlwaysUpdate);
+	return Driver;
+}
+
 AsyncFlow::TTask<void> FCoreTweenSequence::Run(UObject* WorldContext)
 {
-	TArray<FCoreTweenBuilder> LocalSteps = MoveTemp(Steps);
-	for (FCoreTweenBuilder& Step : LocalSteps)
+	return MakeDriver(WorldContext).Run(WorldContext);
+}
+
+FCoreTweenHandle FCoreTweenSequence::Start(UObject* WorldContext)
+{
+	return MakeDriver(WorldContext).Start(WorldContext);
+}
+
+TSharedRef<const FCoreTweenTimeline> FCoreTweenSequence::Compile() const
+{
+	TArray<FCoreTweenTimeline::FTrack> Tracks;
+	Tracks.Reserve(Steps.Num());
+	for (const FStep& Step : Steps)
 	{
-		co_await Step.Run(WorldContext);
+		Tracks.Add({Step.Builder, Step.StartTime, Step.StartTime + Step.Builder.GetTotalDuration()});
 	}
-}
 
+	TArray<FCoreTweenTimeline::FMarker> Markers;
+	Markers.Reserve(Callbacks.Num());
+	for (const FCallback& Callback : Callbacks)
+	{
+		Markers.Add({Callback.Callback, Callback.Time});
+	}
+
+	return MakeShared<FCoreTweenTimeline>(MoveTemp(Tracks), MoveTemp(Markers), Duration);
+}
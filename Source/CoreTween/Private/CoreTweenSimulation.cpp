@@ -0,0 +1,110 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CoreTweenSimulation.h"
+
+#include "CoreTweenBuilder.h"
+#include "CoreTweenEasing.h"
+
+FCoreTweenSimulation::FCoreTweenSimulation()
+{
+	Batches.SetNum(FCoreTweenEasing::NumEasingTypes);
+	for (int32 EasingIdx = 0; EasingIdx < FCoreTweenEasing::NumEasingTypes; ++EasingIdx)
+	{
+		Batches[EasingIdx].EasingType = static_cast<ECoreTweenEasingType>(EasingIdx);
+	}
+}
+
+FCoreTweenSimulation::~FCoreTweenSimulation()
+{
+	Reset();
+}
+
+FCoreTweenHandle FCoreTweenSimulation::Start(FCoreTweenBuilder& Builder)
+{
+	TSharedPtr<FCoreTweenState> State = MakeShared<FCoreTweenState>();
+	Builder.MoveInto(*State);
+	State->Handle = FCoreTweenHandle(States.Num(), 0);
+	State->Begin();
+
+	Batches[static_cast<int32>(State->EasingType)].Add(State.Get());
+	++NumRunning;
+	return States.Add_GetRef(MoveTemp(State))->Handle;
+}
+
+void FCoreTweenSimulation::Tick(const float DeltaTime)
+{
+	// ── Evaluate phase ──
+
+	for (FCoreTweenBatch& Batch : Batches)
+	{
+		Batch.Evaluate(DeltaTime);
+		for (int32 Lane = 0; Lane < Batch.Num(); ++Lane)
+		{
+			Batch.States[Lane]->Advance(DeltaTime, Batch.Alpha[Lane], Batch.Elapsed[Lane], Batch.Rate[Lane]);
+		}
+	}
+
+	// ── Apply phase ──
+
+	for (FCoreTweenBatch& Batch : Batches)
+	{
+		// Walk backwards so each swapped-in lane has already been committed.
+		for (int32 Lane = Batch.Num() - 1; Lane >= 0; --Lane)
+		{
+			FCoreTweenState* State = Batch.States[Lane];
+			if (State->Commit())
+			{
+				State->bFinished.store(true, std::memory_order_release);
+				Batch.RemoveAtSwap(Lane);
+				--NumRunning;
+			}
+		}
+	}
+}
+
+bool FCoreTweenSimulation::Complete(const FCoreTweenHandle Handle)
+{
+	FCoreTweenState* State = States.IsValidIndex(Handle.Index) ? States[Handle.Index].Get() : nullptr;
+	if (!State || State->bFinished.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+	State->bForceComplete.store(true, std::memory_order_release);
+	return true;
+}
+
+void FCoreTweenSimulation::Reset()
+{
+	// Batches hold raw state pointers — drop them before the states.
+	for (FCoreTweenBatch& Batch : Batches)
+	{
+		Batch.Empty();
+	}
+	States.Reset();
+	NumRunning = 0;
+}
+
+const FCoreTweenState* FCoreTweenSimulation::Find(const FCoreTweenHandle Handle) const
+{
+	return States.IsValidIndex(Handle.Index) ? States[Handle.Index].Get() : nullptr;
+}
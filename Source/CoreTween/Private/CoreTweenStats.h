@@ -0,0 +1,69 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("CoreTween"), STATGROUP_CoreTween, STATCAT_Advanced);
+
+// Heap allocations made while launching tweens this frame. 0 in steady state once the pools are warm.
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("State Allocations"), STAT_CoreTweenStateAllocations, STATGROUP_CoreTween, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Target Allocations"), STAT_CoreTweenTargetAllocations, STATGROUP_CoreTween, );
+
+// Recycled objects waiting in the per-world pools.
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled States"), STAT_CoreTweenPooledStates, STATGROUP_CoreTween, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Targets"), STAT_CoreTweenPooledTargets, STATGROUP_CoreTween, );
+
+// Bytes per tween state and builder with sparse property storage, and with every property embedded as before.
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("State Size"), STAT_CoreTweenStateSize, STATGROUP_CoreTween, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("State Size (Dense Properties)"), STAT_CoreTweenDenseStateSize, STATGROUP_CoreTween, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Builder Size"), STAT_CoreTweenBuilderSize, STATGROUP_CoreTween, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Builder Size (Dense Properties)"), STAT_CoreTweenDenseBuilderSize, STATGROUP_CoreTween, );
+
+// Running tweens whose writes are throttled or skipped by tween LOD this frame.
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Irrelevant Tweens"), STAT_CoreTweenIrrelevant, STATGROUP_CoreTween, );
+
+// Game-thread time spent in each phase of the subsystem tick. Evaluate covers the whole ParallelFor, workers included.
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Evaluate"), STAT_CoreTweenEvaluate, STATGROUP_CoreTween, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply"), STAT_CoreTweenApply, STATGROUP_CoreTween, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Timelines"), STAT_CoreTweenTimelines, STATGROUP_CoreTween, );
+
+// Batched tweens per time source, summed over every ticking world.
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Tweens (Game Time)"), STAT_CoreTweenActiveGameTime, STATGROUP_CoreTween, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Tweens (Unpaused)"), STAT_CoreTweenActiveUnpaused, STATGROUP_CoreTween, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Tweens (Real Time)"), STAT_CoreTweenActiveRealTime, STATGROUP_CoreTween, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Tweens (Fixed Step)"), STAT_CoreTweenActiveFixedStep, STATGROUP_CoreTween, );
+
+// FixedStep passes run this frame, fast-forwarded ones included.
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Fixed Steps"), STAT_CoreTweenFixedSteps, STATGROUP_CoreTween, );
+
+// Tweens registered and finished (completed or cancelled) this frame.
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Tweens Started"), STAT_CoreTweenStarted, STATGROUP_CoreTween, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Tweens Finished"), STAT_CoreTweenFinished, STATGROUP_CoreTween, );
+
+// Slot map, batches, pools and tween states owned by every world's subsystem. See UCoreTweenWorldSubsystem::GetAllocatedSize().
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Tween Memory"), STAT_CoreTweenMemory, STATGROUP_CoreTween, );
+
+// Cosmetic writes held back by the apply budget this frame, and ones written over budget after MaxDeferredFrames.
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Writes"), STAT_CoreTweenDeferredWrites, STATGROUP_CoreTween, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Forced Writes"), STAT_CoreTweenForcedWrites, STATGROUP_CoreTween, );
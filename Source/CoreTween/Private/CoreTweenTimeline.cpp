@@ -0,0 +1,288 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CoreTweenTimeline.h"
+
+#include "CoreTween.h"
+
+#include <algorithm>
+
+namespace
+{
+	/** Eased alpha of State at LocalTime seconds after its track's start. Handles delay, loops and ping-pong. */
+	float TrackAlpha(const FCoreTweenState& State, float LocalTime)
+	{
+		LocalTime -= FMath::Max(State.DelayRemaining, 0.0f);
+		const int32 Legs = FMath::Max(State.LoopsRemaining, 1) * (State.bPingPong ? 2 : 1);
+
+		float Alpha;
+		if (State.Duration <= 0.0f)
+		{
+			// Zero-length tracks snap to their end; a ping-pong end is its start.
+			Alpha = LocalTime >= 0.0f && !State.bPingPong ? 1.0f : 0.0f;
+		}
+		else
+		{
+			LocalTime = FMath::Clamp(LocalTime, 0.0f, State.Duration * Legs);
+			const int32 Leg = FMath::Min(FMath::FloorToInt32(LocalTime / State.Duration), Legs - 1);
+			Alpha = FMath::Clamp((LocalTime - Leg * State.Duration) / State.Duration, 0.0f, 1.0f);
+			if (State.bPingPong && (Leg & 1))
+			{
+				Alpha = 1.0f - Alpha;
+			}
+		}
+		return State.Ease(Alpha);
+	}
+} // namespace
+
+// ── FCoreTweenTimeline ──────────────────────────────────────────────
+
+FCoreTweenTimeline::FCoreTweenTimeline(TArray<FTrack>&& InTracks, TArray<FMarker>&& InMarkers, const float InDuration)
+	: Tracks(MoveTemp(InTracks))
+	, Markers(MoveTemp(InMarkers))
+	, Duration(FMath::Max(InDuration, 0.0f))
+{
+	Tracks.StableSort([](const FTrack& A, const FTrack& B) { return A.StartTime < B.StartTime; });
+	Markers.StableSort([](const FMarker& A, const FMarker& B) { return A.Time < B.Time; });
+
+	MaxEndTimes.SetNumUninitialized(Tracks.Num());
+	float MaxEnd = 0.0f;
+	for (int32 Idx = 0; Idx < Tracks.Num(); ++Idx)
+	{
+		MaxEnd = FMath::Max(MaxEnd, Tracks[Idx].EndTime);
+		MaxEndTimes[Idx] = MaxEnd;
+	}
+}
+
+FCoreTweenBuilder FCoreTweenTimeline::Track(const float Duration, const float Delay)
+{
+	return FCoreTweenBuilder(nullptr, nullptr, Duration, Delay, true);
+}
+
+void FCoreTweenTimeline::FindOverlapping(const float From, const float To, int32& OutFirst, int32& OutLast) const
+{
+	// First track that can still be running at From: nothing before it ends at or after From.
+	OutFirst = static_cast<int32>(std::lower_bound(MaxEndTimes.GetData(), MaxEndTimes.GetData() + MaxEndTimes.Num(), From) - MaxEndTimes.GetData());
+
+	// One past the last track that has started by To.
+	OutLast = static_cast<int32>(std::upper_bound(Tracks.GetData(), Tracks.GetData() + Tracks.Num(), To,
+		[](const float Value, const FTrack& Track) { return Value < Track.StartTime; }) - Tracks.GetData());
+}
+
+// ── FCoreTweenTimelinePlayer ────────────────────────────────────────
+
+FCoreTweenTimelinePlayer::FCoreTweenTimelinePlayer(const TSharedRef<const FCoreTweenTimeline>& InTimeline, const TSharedRef<ICoreTweenTarget>& InTarget)
+	: Timeline(InTimeline)
+	, Target(InTarget)
+{
+	States.SetNum(Timeline->Num());
+	for (int32 Idx = 0; Idx < States.Num(); ++Idx)
+	{
+		States[Idx].Target = Target;
+		Timeline->GetTrack(Idx).Template.InitTrackState(States[Idx]);
+	}
+
+	if (!Target->IsTargetValid())
+	{
+		return;
+	}
+
+	// Resolve "from current" values in start order, leaving each track at its end so the next reads what it would at runtime.
+	for (FCoreTweenState& State : States)
+	{
+		State.ReadFromCurrent();
+		State.InvalidateCurrent();
+		State.ApplyAll(TrackAlpha(State, TNumericLimits<float>::Max()));
+	}
+
+	// Then wind everything back to the start.
+	Time = Timeline->GetDuration();
+	Seek(0.0f);
+}
+
+void FCoreTweenTimelinePlayer::Play(UObject* WorldContext)
+{
+	bFireAtCurrentTime = !bReversed && Time <= 0.0f;
+	bPlaying = true;
+	if (!bRegistered)
+	{
+		bRegistered = UCoreTween::RegisterTimelinePlayer(WorldContext, AsShared());
+		bPlaying = bRegistered;
+	}
+}
+
+void FCoreTweenTimelinePlayer::Pause()
+{
+	bPlaying = false;
+}
+
+void FCoreTweenTimelinePlayer::Seek(const float InTime)
+{
+	const float NewTime = FMath::Clamp(InTime, 0.0f, Timeline->GetDuration());
+	Evaluate(Time, NewTime);
+	Time = NewTime;
+	bFireAtCurrentTime = false;
+}
+
+void FCoreTweenTimelinePlayer::Reverse()
+{
+	bReversed = !bReversed;
+}
+
+void FCoreTweenTimelinePlayer::SetPlayRate(const float InPlayRate)
+{
+	PlayRate = FMath::Max(InPlayRate, 0.0f);
+}
+
+bool FCoreTweenTimelinePlayer::Tick(const float DeltaTime)
+{
+	if (!bPlaying || !Target->IsTargetValid())
+	{
+		Detach();
+		return false;
+	}
+
+	const float OldTime = Time;
+	const float Step = DeltaTime * PlayRate;
+	const float NewTime = FMath::Clamp(bReversed ? Time - Step : Time + Step, 0.0f, Timeline->GetDuration());
+	Evaluate(OldTime, NewTime);
+	Time = NewTime;
+
+	if (!bReversed)
+	{
+		FireEvents(OldTime, NewTime, bFireAtCurrentTime);
+	}
+	bFireAtCurrentTime = false;
+
+	// A callback may have paused, reversed or sought.
+	if (bPlaying && Time == NewTime && (bReversed ? Time <= 0.0f : Time >= Timeline->GetDuration()))
+	{
+		bPlaying = false;
+		OnFinishedDelegate.ExecuteIfBound();
+	}
+
+	if (!bPlaying)
+	{
+		Detach();
+		return false;
+	}
+	return true;
+}
+
+void FCoreTweenTimelinePlayer::Detach()
+{
+	bRegistered = false;
+	bPlaying = false;
+}
+
+void FCoreTweenTimelinePlayer::Evaluate(const float OldTime, const float NewTime)
+{
+	if (!Target->IsTargetValid())
+	{
+		return;
+	}
+
+	const float From = FMath::Min(OldTime, NewTime);
+	int32 First;
+	int32 Last;
+	Timeline->FindOverlapping(From, FMath::Max(OldTime, NewTime), First, Last);
+
+	auto ApplyTrack = [this, NewTime](const int32 Idx)
+	{
+		States[Idx].InvalidateCurrent();
+		States[Idx].ApplyAll(TrackAlpha(States[Idx], NewTime - Timeline->GetTrack(Idx).StartTime));
+	};
+
+	// Tracks that have not started at NewTime go back to their start values, latest first, so the earliest wins...
+	for (int32 Idx = Last - 1; Idx >= First; --Idx)
+	{
+		if (Timeline->GetTrack(Idx).StartTime > NewTime)
+		{
+			ApplyTrack(Idx);
+		}
+	}
+
+	// ...then tracks that have ended by NewTime, in end order, as a sequence would have left them. A track
+	// that ended before the span already wrote its end value when the clock crossed it, so it is skipped.
+	TArray<int32, TInlineAllocator<16>> Ended;
+	for (int32 Idx = First; Idx < Last; ++Idx)
+	{
+		const FCoreTweenTimeline::FTrack& Track = Timeline->GetTrack(Idx);
+		if (Track.StartTime <= NewTime && Track.EndTime <= NewTime && Track.EndTime >= From)
+		{
+			Ended.Add(Idx);
+		}
+	}
+	Ended.StableSort([this](const int32 A, const int32 B) { return Timeline->GetTrack(A).EndTime < Timeline->GetTrack(B).EndTime; });
+	for (const int32 Idx : Ended)
+	{
+		ApplyTrack(Idx);
+	}
+
+	// ...then running tracks in start order, so they win over finished ones and later starts win over earlier.
+	for (int32 Idx = First; Idx < Last; ++Idx)
+	{
+		const FCoreTweenTimeline::FTrack& Track = Timeline->GetTrack(Idx);
+		if (Track.StartTime <= NewTime && Track.EndTime > NewTime)
+		{
+			ApplyTrack(Idx);
+		}
+	}
+}
+
+void FCoreTweenTimelinePlayer::FireEvents(const float OldTime, const float NewTime, const bool bInclusive)
+{
+	auto InRange = [OldTime, NewTime, bInclusive](const float EventTime)
+	{
+		return (bInclusive ? EventTime >= OldTime : EventTime > OldTime) && EventTime <= NewTime;
+	};
+
+	// Keep a reference: a callback may drop the last outside reference to this player.
+	const TSharedRef<FCoreTweenTimelinePlayer> KeepAlive = AsShared();
+
+	int32 First;
+	int32 Last;
+	Timeline->FindOverlapping(OldTime, NewTime, First, Last);
+	for (int32 Idx = First; Idx < Last && Time == NewTime; ++Idx)
+	{
+		const FCoreTweenTimeline::FTrack& Track = Timeline->GetTrack(Idx);
+		if (InRange(Track.StartTime + FMath::Max(States[Idx].DelayRemaining, 0.0f)))
+		{
+			States[Idx].OnStartDelegate.ExecuteIfBound();
+		}
+		if (InRange(Track.EndTime))
+		{
+			States[Idx].OnCompleteDelegate.ExecuteIfBound();
+		}
+	}
+
+	const TArray<FCoreTweenTimeline::FMarker>& Markers = Timeline->GetMarkers();
+	const int32 FirstMarker = static_cast<int32>(std::lower_bound(Markers.GetData(), Markers.GetData() + Markers.Num(), OldTime,
+		[](const FCoreTweenTimeline::FMarker& Marker, const float Value) { return Marker.Time < Value; }) - Markers.GetData());
+	for (int32 Idx = FirstMarker; Idx < Markers.Num() && Markers[Idx].Time <= NewTime && Time == NewTime; ++Idx)
+	{
+		if (InRange(Markers[Idx].Time))
+		{
+			Markers[Idx].Callback.ExecuteIfBound();
+		}
+	}
+}
@@ -0,0 +1,98 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CoreTweenTrace.h"
+
+#if CORETWEEN_TRACE_ENABLED
+
+#include "CoreTweenBuilder.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(CoreTweenChannel);
+
+UE_TRACE_EVENT_BEGIN(CoreTween, TweenBegin)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, HandleIndex)
+	UE_TRACE_EVENT_FIELD(uint32, HandleGeneration)
+	UE_TRACE_EVENT_FIELD(float, Duration)
+	UE_TRACE_EVENT_FIELD(uint8, TimeSource)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, TargetName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(CoreTween, TweenEnd)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, HandleIndex)
+	UE_TRACE_EVENT_FIELD(uint32, HandleGeneration)
+	UE_TRACE_EVENT_FIELD(bool, bCancelled)
+UE_TRACE_EVENT_END()
+
+namespace
+{
+	/**
+	 * Region names of the traced tweens still running. The target may be gone by the time they end.
+	 * Keyed by state rather than handle: handles are only unique within one world's subsystem,
+	 * and several worlds (PIE clients, editor plus PIE) trace into this one map.
+	 */
+	TMap<const FCoreTweenState*, FString> GActiveRegions;
+} // namespace
+
+void FCoreTweenTrace::OutputBegin(const FCoreTweenState& State)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(CoreTweenChannel))
+	{
+		return;
+	}
+
+	const UObject* TargetObject = State.TargetObject.Get();
+	const FString TargetName = TargetObject ? TargetObject->GetName() : FString(TEXT("None"));
+	FString RegionName = FString::Printf(TEXT("CoreTween %s #%d"), *TargetName, State.Handle.Index);
+
+	UE_TRACE_LOG(CoreTween, TweenBegin, CoreTweenChannel)
+		<< TweenBegin.Cycle(FPlatformTime::Cycles64())
+		<< TweenBegin.HandleIndex(static_cast<uint32>(State.Handle.Index))
+		<< TweenBegin.HandleGeneration(static_cast<uint32>(State.Handle.Generation))
+		<< TweenBegin.Duration(State.Duration)
+		<< TweenBegin.TimeSource(static_cast<uint8>(State.TimeSource))
+		<< TweenBegin.TargetName(*TargetName, TargetName.Len());
+
+	TRACE_BEGIN_REGION(*RegionName);
+	GActiveRegions.Add(&State, MoveTemp(RegionName));
+}
+
+void FCoreTweenTrace::OutputEnd(const FCoreTweenState& State, const bool bCancelled)
+{
+	FString RegionName;
+	if (!GActiveRegions.RemoveAndCopyValue(&State, RegionName))
+	{
+		return;
+	}
+	TRACE_END_REGION(*RegionName);
+
+	UE_TRACE_LOG(CoreTween, TweenEnd, CoreTweenChannel)
+		<< TweenEnd.Cycle(FPlatformTime::Cycles64())
+		<< TweenEnd.HandleIndex(static_cast<uint32>(State.Handle.Index))
+		<< TweenEnd.HandleGeneration(static_cast<uint32>(State.Handle.Generation))
+		<< TweenEnd.bCancelled(bCancelled);
+}
+
+#endif // CORETWEEN_TRACE_ENABLED
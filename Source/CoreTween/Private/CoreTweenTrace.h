@@ -0,0 +1,59 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+
+struct FCoreTweenState;
+
+#define CORETWEEN_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if CORETWEEN_TRACE_ENABLED
+
+/** Enable with -trace=default,CoreTween (or Trace.Enable CoreTween) to see tween lifetimes in Unreal Insights. */
+UE_TRACE_CHANNEL_EXTERN(CoreTweenChannel);
+
+/**
+ * Emits TweenBegin/TweenEnd events on the CoreTween channel and a timing region
+ * per tween, named after its target, so tween lifetimes show up on the Insights timeline.
+ * Game thread only.
+ */
+struct FCoreTweenTrace
+{
+	/** Called once a state is registered and has its handle. */
+	static void OutputBegin(const FCoreTweenState& State);
+
+	/** Called when a state finishes. Ends its region even if the channel was turned off since it began. */
+	static void OutputEnd(const FCoreTweenState& State, bool bCancelled);
+};
+
+#define TRACE_CORETWEEN_BEGIN(State) FCoreTweenTrace::OutputBegin(State)
+#define TRACE_CORETWEEN_END(State, bCancelled) FCoreTweenTrace::OutputEnd(State, bCancelled)
+
+#else
+
+#define TRACE_CORETWEEN_BEGIN(State)
+#define TRACE_CORETWEEN_END(State, bCancelled)
+
+#endif
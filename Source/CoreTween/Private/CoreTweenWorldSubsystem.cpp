@@ -22,66 +22,1034 @@
 
 #include "CoreTweenWorldSubsystem.h"
 
+#include "CoreTweenStats.h"
+#include "CoreTweenTimeline.h"
+#include "CoreTweenTrace.h"
+#include "Async/ParallelFor.h"
 #include "Components/Widget.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Widgets/SViewport.h"
+
+DEFINE_LOG_CATEGORY(LogCoreTween);
+
+DEFINE_STAT(STAT_CoreTweenStateAllocations);
+DEFINE_STAT(STAT_CoreTweenTargetAllocations);
+DEFINE_STAT(STAT_CoreTweenPooledStates);
+DEFINE_STAT(STAT_CoreTweenPooledTargets);
+DEFINE_STAT(STAT_CoreTweenIrrelevant);
+DEFINE_STAT(STAT_CoreTweenStateSize);
+DEFINE_STAT(STAT_CoreTweenDenseStateSize);
+DEFINE_STAT(STAT_CoreTweenBuilderSize);
+DEFINE_STAT(STAT_CoreTweenDenseBuilderSize);
+DEFINE_STAT(STAT_CoreTweenEvaluate);
+DEFINE_STAT(STAT_CoreTweenApply);
+DEFINE_STAT(STAT_CoreTweenTimelines);
+DEFINE_STAT(STAT_CoreTweenActiveGameTime);
+DEFINE_STAT(STAT_CoreTweenActiveUnpaused);
+DEFINE_STAT(STAT_CoreTweenActiveRealTime);
+DEFINE_STAT(STAT_CoreTweenActiveFixedStep);
+DEFINE_STAT(STAT_CoreTweenFixedSteps);
+DEFINE_STAT(STAT_CoreTweenDeferredWrites);
+DEFINE_STAT(STAT_CoreTweenForcedWrites);
+DEFINE_STAT(STAT_CoreTweenStarted);
+DEFINE_STAT(STAT_CoreTweenFinished);
+DEFINE_STAT(STAT_CoreTweenMemory);
+
+namespace
+{
+	/** Lanes per evaluate task. A multiple of 4, so only a batch's last chunk has a scalar tail. */
+	constexpr int32 LanesPerChunk = 256;
+
+	int32 GCoreTweenParallelThreshold = 2048;
+	FAutoConsoleVariableRef CVarCoreTweenParallelThreshold(
+		TEXT("CoreTween.ParallelThreshold"),
+		GCoreTweenParallelThreshold,
+		TEXT("Running tween count at or above which the evaluate phase is spread over task graph workers. 0 disables it."),
+		ECVF_Default);
+
+	int32 GCoreTweenFixedStepRate = 60;
+	FAutoConsoleVariableRef CVarCoreTweenFixedStepRate(
+		TEXT("CoreTween.FixedStepRate"),
+		GCoreTweenFixedStepRate,
+		TEXT("Default ticks per second of the FixedStep time source for new worlds. UCoreTween::SetFixedStepRate() overrides it per world."),
+		ECVF_Default);
+
+	int32 GCoreTweenFixedStepMaxSteps = 8;
+	FAutoConsoleVariableRef CVarCoreTweenFixedStepMaxSteps(
+		TEXT("CoreTween.FixedStepMaxSteps"),
+		GCoreTweenFixedStepMaxSteps,
+		TEXT("Most fixed steps run in one frame. Game time beyond that is dropped, so a hitch does not snowball."),
+		ECVF_Default);
+
+	float GCoreTweenApplyBudgetMs = 2.0f;
+	FAutoConsoleVariableRef CVarCoreTweenApplyBudgetMs(
+		TEXT("CoreTween.ApplyBudgetMs"),
+		GCoreTweenApplyBudgetMs,
+		TEXT("Default apply budget for new worlds, in ms of game-thread time per frame before Cosmetic writes are deferred. 0 disables it. UCoreTween::SetBudgetSettings() overrides it per world."),
+		ECVF_Default);
+
+	int32 GCoreTweenMaxDeferredFrames = 4;
+	FAutoConsoleVariableRef CVarCoreTweenMaxDeferredFrames(
+		TEXT("CoreTween.MaxDeferredFrames"),
+		GCoreTweenMaxDeferredFrames,
+		TEXT("Default for new worlds: a Cosmetic tween deferred this many frames in a row is written regardless of the budget."),
+		ECVF_Default);
+
+	bool GCoreTweenFixedStepInterpolation = true;
+	FAutoConsoleVariableRef CVarCoreTweenFixedStepInterpolation(
+		TEXT("CoreTween.FixedStepInterpolation"),
+		GCoreTweenFixedStepInterpolation,
+		TEXT("Present FixedStep tweens at the frame's time between steps instead of at the last whole step. Never changes tween state."),
+		ECVF_Default);
+
+	constexpr uint32 FixedStepMask = 1u << static_cast<uint32>(ECoreTweenTimeSource::FixedStep);
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdCoreTweenDump(
+		TEXT("CoreTween.Dump"),
+		TEXT("List the active tweens of this world with their targets and remaining time."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>&, UWorld* World, FOutputDevice& Ar)
+		{
+			if (const UCoreTweenWorldSubsystem* Subsystem = World ? World->GetSubsystem<UCoreTweenWorldSubsystem>() : nullptr)
+			{
+				Subsystem->Dump(Ar);
+			}
+		}));
+} // namespace
 
 void UCoreTweenWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	Batches.SetNum(NumTimeSources * FCoreTweenEasing::NumEasingTypes);
+	for (int32 SourceIdx = 0; SourceIdx < NumTimeSources; ++SourceIdx)
+	{
+		for (int32 EasingIdx = 0; EasingIdx < FCoreTweenEasing::NumEasingTypes; ++EasingIdx)
+		{
+			FCoreTweenBatch& Batch = Batches[SourceIdx * FCoreTweenEasing::NumEasingTypes + EasingIdx];
+			Batch.TimeSource = static_cast<ECoreTweenTimeSource>(SourceIdx);
+			Batch.EasingType = static_cast<ECoreTweenEasingType>(EasingIdx);
+		}
+	}
+
+	SetFixedStepRate(GCoreTweenFixedStepRate);
+
+	FCoreTweenBudgetSettings DefaultBudget;
+	DefaultBudget.ApplyBudgetMs = GCoreTweenApplyBudgetMs;
+	DefaultBudget.MaxDeferredFrames = GCoreTweenMaxDeferredFrames;
+	SetBudgetSettings(DefaultBudget);
+
+	constexpr SIZE_T DenseOverhead = FCoreTweenPropertyStore::DenseSize - sizeof(FCoreTweenPropertyStore);
+	SET_DWORD_STAT(STAT_CoreTweenStateSize, sizeof(FCoreTweenState));
+	SET_DWORD_STAT(STAT_CoreTweenDenseStateSize, sizeof(FCoreTweenState) + DenseOverhead);
+	SET_DWORD_STAT(STAT_CoreTweenBuilderSize, sizeof(FCoreTweenBuilder));
+	SET_DWORD_STAT(STAT_CoreTweenDenseBuilderSize, sizeof(FCoreTweenBuilder) + DenseOverhead);
 }
 
 void UCoreTweenWorldSubsystem::Deinitialize()
 {
+	// Batches hold raw state pointers — drop them before the slots release their states.
+	for (FCoreTweenBatch& Batch : Batches)
+	{
+		Batch.Empty();
+	}
+
 	// Force-cancel all outstanding tweens so coroutines don't outlive the world.
-	for (const TSharedPtr<FCoreTweenState>& State : ActiveTweenStates)
+	for (FTweenSlot& Slot : Slots)
 	{
-		if (!State->bFinished.load(std::memory_order_acquire))
+		if (Slot.State.IsValid() && !Slot.State->bFinished.load(std::memory_order_acquire))
 		{
-			if (State->FlowState.IsValid())
+			if (AsyncFlow::FAsyncFlowState* FlowState = Slot.State->FlowState)
 			{
-				State->FlowState->Cancel();
+				Slot.State->FlowState = nullptr;
+				FlowState->Cancel();
 			}
-			State->FlowState.Reset();
-			State->bFinished.store(true, std::memory_order_release);
+			Slot.State->bFinished.store(true, std::memory_order_release);
+			TRACE_CORETWEEN_END(*Slot.State, true);
 		}
 	}
-	ActiveTweenStates.Empty();
+	for (const TSharedPtr<FCoreTweenTimelinePlayer>& Player : TimelinePlayers)
+	{
+		Player->Detach();
+	}
+	TimelinePlayers.Empty();
+
+	Slots.Empty();
+	FreeSlots.Empty();
+	ObjectIndex.Empty();
+	PendingStates.Empty();
+	PostFlushLaunches.Empty();
+	FinishedStates.Empty();
+	ResumingStates.Empty();
+
+	DEC_DWORD_STAT_BY(STAT_CoreTweenPooledStates, StatePool.Num());
+	DEC_DWORD_STAT_BY(STAT_CoreTweenPooledTargets, WidgetTargetPool.Num());
+	StatePool.Empty();
+	WidgetTargetPool.Empty();
+	SlateWidgetStates.Empty();
+
+	DEC_MEMORY_STAT_BY(STAT_CoreTweenMemory, ReportedMemory);
+	ReportedMemory = 0;
 
 	Super::Deinitialize();
 }
 
-void UCoreTweenWorldSubsystem::RegisterTweenState(TSharedPtr<FCoreTweenState> State)
+TStatId UCoreTweenWorldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCoreTweenWorldSubsystem, STATGROUP_Tickables);
+}
+
+float UCoreTweenWorldSubsystem::GetTimeSourceDelta(const ECoreTweenTimeSource Source) const
+{
+	switch (Source)
+	{
+		case ECoreTweenTimeSource::GameTime:
+		{
+			const UWorld* World = GetWorld();
+			if (!World)
+			{
+				return FApp::GetDeltaTime();
+			}
+			return World->IsPaused() ? 0.0f : World->GetDeltaSeconds();
+		}
+		case ECoreTweenTimeSource::FixedStep:
+			// Whole steps are taken from the accumulator in Tick().
+			return 0.0f;
+		case ECoreTweenTimeSource::Unpaused:
+		case ECoreTweenTimeSource::RealTime:
+		default:
+			return FApp::GetDeltaTime();
+	}
+}
+
+FCoreTweenBatch& UCoreTweenWorldSubsystem::GetBatch(const ECoreTweenTimeSource Source, const ECoreTweenEasingType Easing)
+{
+	return Batches[static_cast<int32>(Source) * FCoreTweenEasing::NumEasingTypes + static_cast<int32>(Easing)];
+}
+
+void UCoreTweenWorldSubsystem::SyncLaneRate(FCoreTweenState& State)
+{
+	if (State.BatchLane != INDEX_NONE)
+	{
+		GetBatch(State.TimeSource, State.EasingType).Rate[State.BatchLane] = State.GetLaneRate();
+	}
+}
+
+ECoreTweenLODPolicy UCoreTweenWorldSubsystem::ResolveLODPolicy(const FCoreTweenState& State) const
+{
+	if (State.Priority == ECoreTweenPriority::Critical)
+	{
+		return ECoreTweenLODPolicy::AlwaysUpdate;
+	}
+	const ECoreTweenLODPolicy Policy = State.LODPolicy != ECoreTweenLODPolicy::Default ? State.LODPolicy : LODSettings.Policy;
+	return Policy == ECoreTweenLODPolicy::Default ? ECoreTweenLODPolicy::AlwaysUpdate : Policy;
+}
+
+bool UCoreTweenWorldSubsystem::ShouldEvaluate(const FCoreTweenState& State) const
 {
+	if (State.bRelevant)
+	{
+		return true;
+	}
+
+	switch (ResolveLODPolicy(State))
+	{
+		case ECoreTweenLODPolicy::Skip:
+			return false;
+		case ECoreTweenLODPolicy::Throttle:
+		{
+			const int32 Interval = State.LODThrottleInterval > 0 ? State.LODThrottleInterval : LODSettings.ThrottleInterval;
+			return Interval <= 1 || (FrameCounter + static_cast<uint32>(State.Handle.Index)) % static_cast<uint32>(Interval) == 0;
+		}
+		default:
+			return true;
+	}
+}
+
+void UCoreTweenWorldSubsystem::UpdateRelevance(FCoreTweenState& State)
+{
+	if (ResolveLODPolicy(State) == ECoreTweenLODPolicy::AlwaysUpdate)
+	{
+		State.bRelevant = true;
+		return;
+	}
+
+	const uint32 Interval = static_cast<uint32>(FMath::Max(LODSettings.RelevanceCheckInterval, 1));
+	if ((FrameCounter + static_cast<uint32>(State.Handle.Index)) % Interval == 0)
+	{
+		State.bRelevant = State.Target->IsRelevant(GetRelevanceContext(), State.PropertyMask);
+	}
+	if (!State.bRelevant)
+	{
+		INC_DWORD_STAT(STAT_CoreTweenIrrelevant);
+	}
+}
+
+const FCoreTweenRelevanceContext& UCoreTweenWorldSubsystem::GetRelevanceContext()
+{
+	if (bRelevanceContextValid)
+	{
+		return RelevanceContext;
+	}
+	bRelevanceContextValid = true;
+
+	RelevanceContext.ViewportRect = FSlateRect(0.0f, 0.0f, 0.0f, 0.0f);
+	RelevanceContext.ViewLocations.Reset();
+	RelevanceContext.MaxViewDistanceSquared = FMath::Square(static_cast<double>(LODSettings.MaxViewDistance));
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return RelevanceContext;
+	}
+
+	if (const UGameViewportClient* ViewportClient = World->GetGameViewport())
+	{
+		if (const TSharedPtr<SViewport> ViewportWidget = ViewportClient->GetGameViewportWidget())
+		{
+			RelevanceContext.ViewportRect = ViewportWidget->GetCachedGeometry().GetLayoutBoundingRect();
+		}
+	}
+
+	if (RelevanceContext.MaxViewDistanceSquared > 0.0)
+	{
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			const APlayerController* PlayerController = It->Get();
+			if (PlayerController && PlayerController->IsLocalController())
+			{
+				FVector ViewLocation;
+				FRotator ViewRotation;
+				PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+				RelevanceContext.ViewLocations.Add(ViewLocation);
+			}
+		}
+	}
+	return RelevanceContext;
+}
+
+void UCoreTweenWorldSubsystem::SetLODSettings(const FCoreTweenLODSettings& InSettings)
+{
+	LODSettings = InSettings;
+	LODSettings.ThrottleInterval = FMath::Max(LODSettings.ThrottleInterval, 1);
+	LODSettings.RelevanceCheckInterval = FMath::Max(LODSettings.RelevanceCheckInterval, 1);
+	LODSettings.MaxViewDistance = FMath::Max(LODSettings.MaxViewDistance, 0.0f);
+}
+
+void UCoreTweenWorldSubsystem::SetBudgetSettings(const FCoreTweenBudgetSettings& InSettings)
+{
+	BudgetSettings = InSettings;
+	BudgetSettings.ApplyBudgetMs = FMath::Max(BudgetSettings.ApplyBudgetMs, 0.0f);
+	BudgetSettings.MaxDeferredFrames = FMath::Clamp(BudgetSettings.MaxDeferredFrames, 1, static_cast<int32>(MAX_uint8));
+	ApplyBudgetCycles = static_cast<uint64>(BudgetSettings.ApplyBudgetMs / 1000.0 / FPlatformTime::GetSecondsPerCycle64());
+}
+
+void UCoreTweenWorldSubsystem::SetFixedStepRate(const int32 Hz)
+{
+	FixedStepRate = FMath::Max(Hz, 1);
+	FixedStepSize = 1.0f / static_cast<float>(FixedStepRate);
+	FixedStepAccumulator = 0.0;
+}
+
+void UCoreTweenWorldSubsystem::FastForwardFixedStep(const int32 NumSteps)
+{
+	if (NumSteps <= 0)
+	{
+		return;
+	}
+	if (bIsTicking)
+	{
+		UE_LOG(LogCoreTween, Warning, TEXT("[CoreTween] FastForwardFixedStep() called from a tween callback, ignored"));
+		return;
+	}
+
+	bIsTicking = true;
+	{
+		FCoreTweenRenderTransformBuffer::FScope TransformScope(RenderTransformBuffer);
+		FCoreTweenComponentTransformBuffer::FScope ComponentScope(ComponentTransformBuffer);
+		FCoreTweenMaterialParameterBuffer::FScope MaterialScope(MaterialParameterBuffer);
+		TickFixedSteps(NumSteps, 0.0f);
+	}
+	bIsTicking = false;
+
+	RunPostFlushLaunches();
 	PruneFinished();
-	ActiveTweenStates.Add(MoveTemp(State));
+	ResumeFinishedWaiters();
 }
 
-int32 UCoreTweenWorldSubsystem::Clear(UWidget* Widget)
+SIZE_T UCoreTweenWorldSubsystem::GetAllocatedSize() const
 {
-	int32 NumCancelled = 0;
-	for (int32 Idx = ActiveTweenStates.Num() - 1; Idx >= 0; --Idx)
+	SIZE_T Size = Slots.GetAllocatedSize() + FreeSlots.GetAllocatedSize() + ObjectIndex.GetAllocatedSize()
+		+ Batches.GetAllocatedSize() + EvaluateChunks.GetAllocatedSize() + PendingStates.GetAllocatedSize()
+		+ FinishedStates.GetAllocatedSize() + ResumingStates.GetAllocatedSize() + StatePool.GetAllocatedSize()
+		+ TimelinePlayers.GetAllocatedSize() + WidgetTargetPool.GetAllocatedSize();
+	for (const FCoreTweenBatch& Batch : Batches)
 	{
-		TSharedPtr<FCoreTweenState>& State = ActiveTweenStates[Idx];
-		if (State->Widget.Get() == Widget)
+		Size += Batch.GetAllocatedSize();
+	}
+
+	// Released slots drop their state, so live slots plus the pool is every state this world owns.
+	const int32 NumStates = Slots.Num() - FreeSlots.Num() + StatePool.Num();
+	Size += NumStates * sizeof(FCoreTweenState) + WidgetTargetPool.Num() * sizeof(FWidgetTweenTarget);
+	return Size;
+}
+
+float UCoreTweenWorldSubsystem::GetRemainingTime(const FCoreTweenState& State) const
+{
+	if (State.bFollow || State.LoopsRemaining < 0)
+	{
+		return -1.0f;
+	}
+
+	// Tweens registered during this tick have no lane yet and have not started their lap.
+	float Elapsed = 0.0f;
+	if (State.BatchLane != INDEX_NONE)
+	{
+		const int32 BatchIdx = static_cast<int32>(State.TimeSource) * FCoreTweenEasing::NumEasingTypes + static_cast<int32>(State.EasingType);
+		Elapsed = Batches[BatchIdx].Elapsed[State.BatchLane];
+	}
+
+	// On a ping-pong return leg elapsed counts back down to 0.
+	float LapRemaining = State.bForward ? State.Duration - Elapsed : Elapsed;
+	if (State.bPingPong && State.bForward)
+	{
+		LapRemaining += State.Duration;
+	}
+
+	const float LapTime = State.bPingPong ? 2.0f * State.Duration : State.Duration;
+	const float Delay = State.bStarted ? 0.0f : State.DelayRemaining;
+	return Delay + LapRemaining + FMath::Max(State.LoopsRemaining - 1, 0) * LapTime;
+}
+
+void UCoreTweenWorldSubsystem::Dump(FOutputDevice& Ar) const
+{
+	const UEnum* TimeSourceEnum = StaticEnum<ECoreTweenTimeSource>();
+	const UEnum* EasingEnum = StaticEnum<ECoreTweenEasingType>();
+
+	int32 NumActive = 0;
+	for (const FTweenSlot& Slot : Slots)
+	{
+		const FCoreTweenState* State = Slot.State.Get();
+		if (!State || State->bFinished.load(std::memory_order_acquire))
 		{
-			if (!State->bFinished.load(std::memory_order_acquire) && State->FlowState.IsValid())
+			continue;
+		}
+		++NumActive;
+
+		const UObject* TargetObject = State->TargetObject.Get();
+		const TCHAR* Status = State->bPaused ? TEXT("Paused") : !State->bStarted ? TEXT("Delayed") : State->bFollow ? TEXT("Following") : TEXT("Running");
+		const float Remaining = GetRemainingTime(*State);
+
+		Ar.Logf(TEXT("  #%d.%d %s  %s %s  Properties=0x%04X  %s  Remaining=%s"),
+			State->Handle.Index,
+			State->Handle.Generation,
+			TargetObject ? *TargetObject->GetPathName() : TEXT("None"),
+			*TimeSourceEnum->GetNameStringByValue(static_cast<int64>(State->TimeSource)),
+			*EasingEnum->GetNameStringByValue(static_cast<int64>(State->EasingType)),
+			static_cast<uint32>(State->PropertyMask),
+			Status,
+			Remaining < 0.0f ? TEXT("inf") : *FString::Printf(TEXT("%.2fs"), Remaining));
+	}
+
+	Ar.Logf(TEXT("[CoreTween] %s: %d active tweens, %d timeline players, %d pooled states, %.1f KB"),
+		*GetNameSafe(GetWorld()),
+		NumActive,
+		TimelinePlayers.Num(),
+		StatePool.Num(),
+		GetAllocatedSize() / 1024.0);
+}
+
+void UCoreTweenWorldSubsystem::EvaluateChunk(const FEvaluateChunk& Chunk, const float (&SourceDeltas)[NumTimeSources], const FBatchPass& Pass)
+{
+	FCoreTweenBatch& Batch = Batches[Chunk.BatchIndex];
+	const float SourceDelta = SourceDeltas[static_cast<int32>(Batch.TimeSource)];
+	if (Pass.bAdvance)
+	{
+		Batch.Evaluate(SourceDelta, Chunk.StartLane, Chunk.NumLanes);
+	}
+
+	const int32 EndLane = Chunk.StartLane + Chunk.NumLanes;
+	for (int32 Lane = Chunk.StartLane; Lane < EndLane; ++Lane)
+	{
+		FCoreTweenState* State = Batch.States[Lane];
+		if (State->bPaused || State->bFinished.load(std::memory_order_acquire))
+		{
+			State->StepEvents = ECoreTweenStepEvents::None;
+			continue;
+		}
+
+		const bool bEvaluate = ShouldEvaluate(*State);
+		if (Pass.bAdvance)
+		{
+			State->Advance(SourceDelta, Batch.Alpha[Lane], Batch.Elapsed[Lane], Batch.Rate[Lane], bEvaluate && (!Pass.bTimingOnly || State->bFollow));
+		}
+		else
+		{
+			State->StepEvents = State->bForceComplete.load(std::memory_order_acquire) ? ECoreTweenStepEvents::ForceComplete : ECoreTweenStepEvents::None;
+		}
+
+		// Only the presented values move between steps; Elapsed stays on the step.
+		if (Pass.PresentOffset > 0.0f && bEvaluate)
+		{
+			const float PresentElapsed = FMath::Clamp(Batch.Elapsed[Lane] + Pass.PresentOffset * Batch.Rate[Lane], 0.0f, Batch.Duration[Lane]);
+			State->Present(PresentElapsed);
+		}
+	}
+}
+
+void UCoreTweenWorldSubsystem::TickBatches(const float (&SourceDeltas)[NumTimeSources], const FBatchPass& Pass)
+{
+	// ── Evaluate phase — touches only batch lanes and tween states ──
+
+	EvaluateChunks.Reset();
+	int32 NumLanes = 0;
+	for (int32 BatchIdx = 0; BatchIdx < Batches.Num(); ++BatchIdx)
+	{
+		if (!(Pass.SourceMask & (1u << static_cast<uint32>(Batches[BatchIdx].TimeSource))))
+		{
+			continue;
+		}
+		const int32 BatchLanes = Batches[BatchIdx].Num();
+		for (int32 StartLane = 0; StartLane < BatchLanes; StartLane += LanesPerChunk)
+		{
+			EvaluateChunks.Add({BatchIdx, StartLane, FMath::Min(LanesPerChunk, BatchLanes - StartLane)});
+		}
+		NumLanes += BatchLanes;
+	}
+	if (EvaluateChunks.IsEmpty())
+	{
+		return;
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_CoreTweenEvaluate);
+		const bool bParallel = GCoreTweenParallelThreshold > 0 && NumLanes >= GCoreTweenParallelThreshold && EvaluateChunks.Num() > 1;
+		ParallelFor(
+			EvaluateChunks.Num(),
+			[this, &SourceDeltas, &Pass](const int32 ChunkIdx) { EvaluateChunk(EvaluateChunks[ChunkIdx], SourceDeltas, Pass); },
+			bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+	}
+
+	// ── Apply phase — game thread: target writes and callbacks ──
+
+	SCOPE_CYCLE_COUNTER(STAT_CoreTweenApply);
+	const uint64 ApplyStartCycles = FPlatformTime::Cycles64();
+	const bool bBudgeted = ApplyBudgetCycles > 0;
+	for (FCoreTweenBatch& Batch : Batches)
+	{
+		if (!(Pass.SourceMask & (1u << static_cast<uint32>(Batch.TimeSource))))
+		{
+			continue;
+		}
+
+		// Lanes are stable for the whole pass: registrations made from callbacks go to PendingStates.
+		for (int32 Lane = 0; Lane < Batch.Num(); ++Lane)
+		{
+			FCoreTweenState* State = Batch.States[Lane];
+
+			// An earlier callback this frame may have cancelled it.
+			if (State->bFinished.load(std::memory_order_acquire))
+			{
+				continue;
+			}
+			if (bBudgeted && State->Priority == ECoreTweenPriority::Cosmetic)
 			{
-				State->FlowState->Cancel();
+				CosmeticLanes.Add(State);
+				continue;
 			}
-			State->FlowState.Reset();
-			State->bFinished.store(true, std::memory_order_release);
-			ActiveTweenStates.RemoveAtSwap(Idx);
-			NumCancelled++;
+			CommitLane(*State, false);
 		}
 	}
-	return NumCancelled;
+
+	if (CosmeticLanes.Num() > 0)
+	{
+		CommitCosmeticLanes(ApplyStartCycles);
+	}
+	ApplyCyclesSpent += FPlatformTime::Cycles64() - ApplyStartCycles;
+}
+
+void UCoreTweenWorldSubsystem::CommitLane(FCoreTweenState& State, const bool bDeferWrite)
+{
+	if (State.Commit(bDeferWrite))
+	{
+		FinishTween(Slots[State.Handle.Index].State, false);
+		return;
+	}
+	UpdateRelevance(State);
+}
+
+void UCoreTweenWorldSubsystem::CommitCosmeticLanes(const uint64 PassStartCycles)
+{
+	// Reading the clock per lane would cost more than many writes; once spent, the budget stays spent.
+	constexpr int32 LanesPerBudgetCheck = 8;
+	bool bBudgetSpent = false;
+
+	for (int32 Idx = 0; Idx < CosmeticLanes.Num(); ++Idx)
+	{
+		if (!bBudgetSpent && Idx % LanesPerBudgetCheck == 0)
+		{
+			bBudgetSpent = ApplyCyclesSpent + (FPlatformTime::Cycles64() - PassStartCycles) >= ApplyBudgetCycles;
+		}
+
+		// An earlier callback this frame may have cancelled it.
+		FCoreTweenState& State = *CosmeticLanes[Idx];
+		if (State.bFinished.load(std::memory_order_acquire))
+		{
+			continue;
+		}
+
+		// Only frames that would write count toward the starvation limit.
+		const bool bWrites = State.bWritePending || EnumHasAnyFlags(State.StepEvents, ECoreTweenStepEvents::Evaluated);
+		bool bDefer = false;
+		if (bBudgetSpent && bWrites)
+		{
+			bDefer = State.DeferredFrames < BudgetSettings.MaxDeferredFrames;
+			if (bDefer)
+			{
+				++State.DeferredFrames;
+				INC_DWORD_STAT(STAT_CoreTweenDeferredWrites);
+			}
+			else
+			{
+				INC_DWORD_STAT(STAT_CoreTweenForcedWrites);
+			}
+		}
+		if (!bDefer)
+		{
+			State.DeferredFrames = 0;
+		}
+		CommitLane(State, bDefer);
+	}
+	CosmeticLanes.Reset();
+}
+
+void UCoreTweenWorldSubsystem::TickFixedSteps(const int32 NumSteps, const float PresentOffset)
+{
+	float StepDeltas[NumTimeSources] = {};
+	StepDeltas[static_cast<int32>(ECoreTweenTimeSource::FixedStep)] = FixedStepSize;
+
+	// Each step is a full evaluate + apply pass, so callbacks fire on the step that raised them.
+	// Only the last step's values are seen, so earlier ones advance timing alone, and so
+	// does the last one when Present() is about to overwrite its values anyway.
+	for (int32 Step = 0; Step < NumSteps; ++Step)
+	{
+		const bool bLastStep = Step == NumSteps - 1;
+		TickBatches(StepDeltas, {FixedStepMask, true, !bLastStep || PresentOffset > 0.0f, bLastStep ? PresentOffset : 0.0f});
+		++FixedStepTick;
+	}
+	INC_DWORD_STAT_BY(STAT_CoreTweenFixedSteps, NumSteps);
+
+	// No whole step this frame: move the presented values alone.
+	if (NumSteps == 0 && PresentOffset > 0.0f)
+	{
+		TickBatches(StepDeltas, {FixedStepMask, false, false, PresentOffset});
+	}
 }
 
-bool UCoreTweenWorldSubsystem::GetIsTweening(UWidget* Widget)
+void UCoreTweenWorldSubsystem::TickTimelinePlayers(const float (&SourceDeltas)[NumTimeSources])
 {
+	// Index loop: players started from callbacks are appended and tick this frame too.
+	for (int32 Idx = 0; Idx < TimelinePlayers.Num();)
+	{
+		const TSharedPtr<FCoreTweenTimelinePlayer> Player = TimelinePlayers[Idx];
+		if (Player->Tick(SourceDeltas[static_cast<int32>(Player->GetTimeSource())]))
+		{
+			++Idx;
+		}
+		else
+		{
+			TimelinePlayers.RemoveAtSwap(Idx, EAllowShrinking::No);
+		}
+	}
+}
+
+void UCoreTweenWorldSubsystem::AddTimelinePlayer(const TSharedRef<FCoreTweenTimelinePlayer>& Player)
+{
+	TimelinePlayers.Add(Player);
+}
+
+void UCoreTweenWorldSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	float SourceDeltas[NumTimeSources];
+	for (int32 SourceIdx = 0; SourceIdx < NumTimeSources; ++SourceIdx)
+	{
+		SourceDeltas[SourceIdx] = GetTimeSourceDelta(static_cast<ECoreTweenTimeSource>(SourceIdx));
+	}
+
+	// FixedStep: take whole steps out of the accumulated game time. Its entry is their total, for timeline players.
+	FixedStepAccumulator += SourceDeltas[static_cast<int32>(ECoreTweenTimeSource::GameTime)];
+	int32 NumFixedSteps = FMath::FloorToInt32(FixedStepAccumulator * FixedStepRate);
+	FixedStepAccumulator -= static_cast<double>(NumFixedSteps) / FixedStepRate;
+	if (NumFixedSteps > GCoreTweenFixedStepMaxSteps)
+	{
+		NumFixedSteps = FMath::Max(GCoreTweenFixedStepMaxSteps, 1);
+		FixedStepAccumulator = 0.0;
+	}
+	SourceDeltas[static_cast<int32>(ECoreTweenTimeSource::FixedStep)] = NumFixedSteps * FixedStepSize;
+	const float PresentOffset = GCoreTweenFixedStepInterpolation ? static_cast<float>(FixedStepAccumulator) : 0.0f;
+
+#if STATS
+	int32 SourceLanes[NumTimeSources] = {};
+	for (const FCoreTweenBatch& Batch : Batches)
+	{
+		SourceLanes[static_cast<int32>(Batch.TimeSource)] += Batch.Num();
+	}
+	INC_DWORD_STAT_BY(STAT_CoreTweenActiveGameTime, SourceLanes[static_cast<int32>(ECoreTweenTimeSource::GameTime)]);
+	INC_DWORD_STAT_BY(STAT_CoreTweenActiveUnpaused, SourceLanes[static_cast<int32>(ECoreTweenTimeSource::Unpaused)]);
+	INC_DWORD_STAT_BY(STAT_CoreTweenActiveRealTime, SourceLanes[static_cast<int32>(ECoreTweenTimeSource::RealTime)]);
+	INC_DWORD_STAT_BY(STAT_CoreTweenActiveFixedStep, SourceLanes[static_cast<int32>(ECoreTweenTimeSource::FixedStep)]);
+#endif
+
+	++FrameCounter;
+	bRelevanceContextValid = false;
+	ApplyCyclesSpent = 0;
+
+	bIsTicking = true;
+	{
+		// Widget render transforms, component transforms and material parameters are written once per object when these scopes close.
+		FCoreTweenRenderTransformBuffer::FScope TransformScope(RenderTransformBuffer);
+		FCoreTweenComponentTransformBuffer::FScope ComponentScope(ComponentTransformBuffer);
+		FCoreTweenMaterialParameterBuffer::FScope MaterialScope(MaterialParameterBuffer);
+		TickBatches(SourceDeltas, {~FixedStepMask});
+		TickFixedSteps(NumFixedSteps, PresentOffset);
+
+		SCOPE_CYCLE_COUNTER(STAT_CoreTweenTimelines);
+		TickTimelinePlayers(SourceDeltas);
+	}
+	bIsTicking = false;
+
+	// Sequence steps due this frame start now, from the values the pass just flushed.
+	RunPostFlushLaunches();
+
+	// Drop finished lanes first: releasing a slot below may free the state a lane points at.
 	PruneFinished();
-	for (const TSharedPtr<FCoreTweenState>& State : ActiveTweenStates)
+
+	// Waiters run after the batch so their continuations can freely start or clear tweens.
+	ResumeFinishedWaiters();
+
+	for (TSharedPtr<FCoreTweenState>& State : PendingStates)
 	{
-		if (State->Widget.Get() == Widget && !State->bFinished.load(std::memory_order_acquire))
+		if (!State->bFinished.load(std::memory_order_acquire))
+		{
+			GetBatch(State->TimeSource, State->EasingType).Add(State.Get());
+		}
+	}
+	PendingStates.Reset();
+
+#if STATS
+	const SIZE_T Memory = GetAllocatedSize();
+	INC_MEMORY_STAT_BY(STAT_CoreTweenMemory, Memory);
+	DEC_MEMORY_STAT_BY(STAT_CoreTweenMemory, ReportedMemory);
+	ReportedMemory = Memory;
+#endif
+}
+
+FCoreTweenHandle UCoreTweenWorldSubsystem::RegisterTweenState(TSharedPtr<FCoreTweenState> State)
+{
+	if (!State.IsValid())
+	{
+		return FCoreTweenHandle();
+	}
+
+	int32 SlotIndex;
+	if (FreeSlots.Num() > 0)
+	{
+		SlotIndex = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		SlotIndex = Slots.AddDefaulted();
+	}
+
+	FTweenSlot& Slot = Slots[SlotIndex];
+	Slot.State = State;
+	State->Handle = FCoreTweenHandle(SlotIndex, Slot.Generation);
+
+	if (UObject* TargetObject = State->TargetObject.Get())
+	{
+		Slot.ObjectKeys.Add(TObjectKey<UObject>(TargetObject));
+	}
+	if (State->Target)
+	{
+		TArray<UObject*> ExtraObjects;
+		State->Target->GetExtraTargetObjects(ExtraObjects);
+		for (UObject* Object : ExtraObjects)
+		{
+			if (Object)
+			{
+				Slot.ObjectKeys.AddUnique(TObjectKey<UObject>(Object));
+			}
+		}
+	}
+	for (const TObjectKey<UObject>& Key : Slot.ObjectKeys)
+	{
+		ObjectIndex.FindOrAdd(Key).Add(SlotIndex);
+	}
+
+	const FCoreTweenHandle Handle = State->Handle;
+	INC_DWORD_STAT(STAT_CoreTweenStarted);
+	TRACE_CORETWEEN_BEGIN(*State);
+	State->Begin();
+
+	if (bIsTicking)
+	{
+		PendingStates.Add(MoveTemp(State));
+	}
+	else
+	{
+		GetBatch(State->TimeSource, State->EasingType).Add(State.Get());
+	}
+	return Handle;
+}
+
+FCoreTweenState* UCoreTweenWorldSubsystem::Find(const FCoreTweenHandle Handle) const
+{
+	if (!Slots.IsValidIndex(Handle.Index))
+	{
+		return nullptr;
+	}
+	const FTweenSlot& Slot = Slots[Handle.Index];
+	if (Slot.Generation != Handle.Generation || !Slot.State.IsValid())
+	{
+		return nullptr;
+	}
+	return Slot.State.Get();
+}
+
+TSharedPtr<FCoreTweenState> UCoreTweenWorldSubsystem::FindShared(const FCoreTweenHandle Handle) const
+{
+	return Find(Handle) ? Slots[Handle.Index].State : nullptr;
+}
+
+void UCoreTweenWorldSubsystem::FinishTween(const TSharedPtr<FCoreTweenState>& State, const bool bCancel)
+{
+	if (State->bFinished.load(std::memory_order_acquire))
+	{
+		return;
+	}
+	const TSharedPtr<ICoreTweenTarget> CancelledTarget = bCancel ? State->Target : nullptr;
+	AsyncFlow::FAsyncFlowState* FlowState = State->FlowState;
+	State->FlowState = nullptr;
+	if (bCancel && FlowState)
+	{
+		FlowState->Cancel();
+	}
+	State->bFinished.store(true, std::memory_order_release);
+	FinishedStates.Add(State);
+	INC_DWORD_STAT(STAT_CoreTweenFinished);
+	TRACE_CORETWEEN_END(*State, bCancel);
+
+	// Lets drivers such as sequences cancel the tweens they launched.
+	if (CancelledTarget)
+	{
+		CancelledTarget->OnTweenCancelled();
+	}
+}
+
+void UCoreTweenWorldSubsystem::LaunchAfterFlush(TFunction<void()> Launch)
+{
+	if (!bIsTicking)
+	{
+		Launch();
+		return;
+	}
+	PostFlushLaunches.Add(MoveTemp(Launch));
+}
+
+void UCoreTweenWorldSubsystem::RunPostFlushLaunches()
+{
+	// Outside the pass, launches register their tweens straight into the batches and queue nothing more.
+	for (TFunction<void()>& Launch : PostFlushLaunches)
+	{
+		Launch();
+	}
+	PostFlushLaunches.Reset();
+}
+
+void UCoreTweenWorldSubsystem::ResumeFinishedWaiters()
+{
+	// Continuations may finish more tweens; those land in the (now empty) FinishedStates for next tick.
+	Swap(FinishedStates, ResumingStates);
+
+	for (TSharedPtr<FCoreTweenState>& State : ResumingStates)
+	{
+		if (std::coroutine_handle<> Waiter = State->Waiter)
+		{
+			State->Waiter = nullptr;
+			Waiter.resume();
+		}
+		const FCoreTweenHandle Handle = State->Handle;
+		State.Reset();
+		ReleaseSlot(Handle);
+	}
+	ResumingStates.Reset();
+}
+
+void UCoreTweenWorldSubsystem::ReleaseSlot(const FCoreTweenHandle& Handle)
+{
+	if (!Slots.IsValidIndex(Handle.Index))
+	{
+		return;
+	}
+	FTweenSlot& Slot = Slots[Handle.Index];
+	if (Slot.Generation != Handle.Generation)
+	{
+		return;
+	}
+
+	for (const TObjectKey<UObject>& Key : Slot.ObjectKeys)
+	{
+		RemoveFromObjectIndex(Key, Handle.Index);
+	}
+
+	RecycleState(MoveTemp(Slot.State));
+	Slot.ObjectKeys.Reset();
+	Slot.Generation++;
+	FreeSlots.Add(Handle.Index);
+}
+
+void UCoreTweenWorldSubsystem::RecycleState(TSharedPtr<FCoreTweenState>&& State)
+{
+	// Still referenced (e.g. a Run() frame that has not been destroyed yet) — let it die normally.
+	if (!State.IsValid() || !State.IsUnique())
+	{
+		State.Reset();
+		return;
+	}
+
+	if (State->bPooledTarget && State->Target.IsUnique())
+	{
+		TSharedPtr<FWidgetTweenTarget> WidgetTarget = StaticCastSharedPtr<FWidgetTweenTarget>(MoveTemp(State->Target));
+		WidgetTarget->SetWidget(nullptr);
+		WidgetTargetPool.Add(MoveTemp(WidgetTarget));
+		INC_DWORD_STAT(STAT_CoreTweenPooledTargets);
+	}
+
+	State->Reset();
+	StatePool.Add(MoveTemp(State));
+	INC_DWORD_STAT(STAT_CoreTweenPooledStates);
+}
+
+TSharedPtr<FCoreTweenState> UCoreTweenWorldSubsystem::AcquireState()
+{
+	if (StatePool.Num() > 0)
+	{
+		DEC_DWORD_STAT(STAT_CoreTweenPooledStates);
+		return StatePool.Pop(EAllowShrinking::No);
+	}
+
+	INC_DWORD_STAT(STAT_CoreTweenStateAllocations);
+	return MakeShared<FCoreTweenState>();
+}
+
+TSharedPtr<FWidgetTweenTarget> UCoreTweenWorldSubsystem::AcquireWidgetTarget(UWidget* Widget)
+{
+	if (WidgetTargetPool.Num() > 0)
+	{
+		DEC_DWORD_STAT(STAT_CoreTweenPooledTargets);
+		TSharedPtr<FWidgetTweenTarget> Target = WidgetTargetPool.Pop(EAllowShrinking::No);
+		Target->SetWidget(Widget);
+		return Target;
+	}
+
+	INC_DWORD_STAT(STAT_CoreTweenTargetAllocations);
+	return MakeShared<FWidgetTweenTarget>(Widget);
+}
+
+TSharedRef<FSlateWidgetTweenState> UCoreTweenWorldSubsystem::AcquireSlateWidgetState(UWidget* Widget)
+{
+	if (const TSharedPtr<FSlateWidgetTweenState>* Existing = SlateWidgetStates.Find(Widget))
+	{
+		return Existing->ToSharedRef();
+	}
+
+	// Only misses pay for dropping the states of destroyed widgets.
+	for (auto It = SlateWidgetStates.CreateIterator(); It; ++It)
+	{
+		if (!It.Value()->Widget.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TSharedRef<FSlateWidgetTweenState> State = MakeShared<FSlateWidgetTweenState>(Widget);
+	SlateWidgetStates.Add(Widget, State);
+	return State;
+}
+
+void UCoreTweenWorldSubsystem::RemoveFromObjectIndex(const TObjectKey<UObject>& Key, const int32 SlotIndex)
+{
+	if (TArray<int32, TInlineAllocator<2>>* ObjectSlots = ObjectIndex.Find(Key))
+	{
+		ObjectSlots->RemoveSingleSwap(SlotIndex, EAllowShrinking::No);
+		if (ObjectSlots->IsEmpty())
+		{
+			ObjectIndex.Remove(Key);
+		}
+	}
+}
+
+void UCoreTweenWorldSubsystem::ResetSlateWidgetState(UWidget* Widget)
+{
+	SlateWidgetStates.Remove(Widget);
+}
+
+int32 UCoreTweenWorldSubsystem::Clear(UObject* Object)
+{
+	const TArray<int32, TInlineAllocator<2>>* ObjectSlots = ObjectIndex.Find(TObjectKey<UObject>(Object));
+	if (!ObjectSlots)
+	{
+		return 0;
+	}
+
+	// Copy: cancelling a flow can run arbitrary continuations that register new tweens and rehash the index.
+	const TArray<int32, TInlineAllocator<2>> SlotsToClear = *ObjectSlots;
+
+	const TObjectKey<UObject> Key(Object);
+	int32 NumCancelled = 0;
+	for (const int32 SlotIndex : SlotsToClear)
+	{
+		FTweenSlot& Slot = Slots[SlotIndex];
+		const TSharedPtr<FCoreTweenState>& State = Slot.State;
+		if (!State.IsValid() || State->bFinished.load(std::memory_order_acquire))
+		{
+			continue;
+		}
+
+		// A tween spanning several objects can let go of just this one and keep animating the rest.
+		const bool bExtraObject = State->TargetObject.Get() != Object;
+		if (bExtraObject && State->Target && State->Target->ReleaseTargetObject(Object))
+		{
+			Slot.ObjectKeys.RemoveSingleSwap(Key, EAllowShrinking::No);
+			RemoveFromObjectIndex(Key, SlotIndex);
+		}
+		else
+		{
+			FinishTween(State, true);
+		}
+		NumCancelled++;
+	}
+	return NumCancelled;
+}
+
+bool UCoreTweenWorldSubsystem::GetIsTweening(UObject* Object) const
+{
+	const TArray<int32, TInlineAllocator<2>>* ObjectSlots = ObjectIndex.Find(TObjectKey<UObject>(Object));
+	if (!ObjectSlots)
+	{
+		return false;
+	}
+
+	for (const int32 SlotIndex : *ObjectSlots)
+	{
+		const TSharedPtr<FCoreTweenState>& State = Slots[SlotIndex].State;
+		if (State.IsValid() && !State->bFinished.load(std::memory_order_acquire))
 		{
 			return true;
 		}
@@ -91,19 +1059,138 @@ bool UCoreTweenWorldSubsystem::GetIsTweening(UWidget* Widget)
 
 void UCoreTweenWorldSubsystem::CompleteAll()
 {
-	for (const TSharedPtr<FCoreTweenState>& State : ActiveTweenStates)
+	for (const FTweenSlot& Slot : Slots)
 	{
-		if (!State->bFinished.load(std::memory_order_acquire))
+		if (Slot.State.IsValid() && !Slot.State->bFinished.load(std::memory_order_acquire))
 		{
-			State->bForceComplete.store(true, std::memory_order_release);
+			Slot.State->bForceComplete.store(true, std::memory_order_release);
+			Slot.State->bPaused = false;
+			SyncLaneRate(*Slot.State);
 		}
 	}
 }
 
+bool UCoreTweenWorldSubsystem::Pause(const FCoreTweenHandle Handle)
+{
+	FCoreTweenState* State = Find(Handle);
+	if (!State || State->bFinished.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+	State->bPaused = true;
+	SyncLaneRate(*State);
+	return true;
+}
+
+bool UCoreTweenWorldSubsystem::Resume(const FCoreTweenHandle Handle)
+{
+	FCoreTweenState* State = Find(Handle);
+	if (!State || State->bFinished.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+	State->bPaused = false;
+	SyncLaneRate(*State);
+	return true;
+}
+
+bool UCoreTweenWorldSubsystem::Complete(const FCoreTweenHandle Handle)
+{
+	FCoreTweenState* State = Find(Handle);
+	if (!State || State->bFinished.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+	State->bForceComplete.store(true, std::memory_order_release);
+	State->bPaused = false;
+	SyncLaneRate(*State);
+	return true;
+}
+
+bool UCoreTweenWorldSubsystem::Retarget(const FCoreTweenHandle Handle, const ECoreTweenProperty Property, const float NewDuration, TFunctionRef<void(FCoreTweenState&)> SetTarget)
+{
+	FCoreTweenState* State = Find(Handle);
+	if (!State || State->bFinished.load(std::memory_order_acquire) || !EnumHasAllFlags(State->PropertyMask, Property))
+	{
+		return false;
+	}
+
+	if (State->bFollow)
+	{
+		SetTarget(*State);
+		return true;
+	}
+
+	FCoreTweenBatch* Batch = State->BatchLane != INDEX_NONE ? &GetBatch(State->TimeSource, State->EasingType) : nullptr;
+	const float Elapsed = Batch ? Batch->Elapsed[State->BatchLane] : 0.0f;
+
+	// A second retarget in the same frame finds the lap already rebased and only swaps the target.
+	const bool bAlreadyRebased = State->bCarryVelocity && Elapsed == 0.0f;
+	if (State->bStarted && !bAlreadyRebased)
+	{
+		const float Alpha = State->Duration > 0.0f ? FMath::Clamp(Elapsed / State->Duration, 0.0f, 1.0f) : 1.0f;
+
+		// Slope of the easing curve by central difference, one-sided at the ends.
+		constexpr float H = 1.0e-3f;
+		const float A0 = FMath::Max(Alpha - H, 0.0f);
+		const float A1 = FMath::Min(Alpha + H, 1.0f);
+		const float EaseSlope = State->Duration > 0.0f
+			? (State->Ease(A1) - State->Ease(A0)) / ((A1 - A0) * State->Duration) * (State->bForward ? 1.0f : -1.0f)
+			: 0.0f;
+		const float VelocityDecay = State->bCarryVelocity ? (1.0f - Alpha) * (1.0f - 3.0f * Alpha) : 0.0f;
+		State->Rebase(EaseSlope, VelocityDecay);
+	}
+
+	SetTarget(*State);
+
+	if (NewDuration >= 0.0f)
+	{
+		State->Duration = NewDuration;
+	}
+	State->bForward = true;
+	State->bCarryVelocity = State->bStarted;
+	State->VelocityWeight = 0.0f;
+	if (Batch)
+	{
+		Batch->Elapsed[State->BatchLane] = 0.0f;
+		Batch->Duration[State->BatchLane] = State->Duration;
+		Batch->Rate[State->BatchLane] = State->GetLaneRate();
+	}
+	return true;
+}
+
+bool UCoreTweenWorldSubsystem::Cancel(const FCoreTweenHandle Handle)
+{
+	if (!Find(Handle))
+	{
+		return false;
+	}
+	const TSharedPtr<FCoreTweenState>& State = Slots[Handle.Index].State;
+	if (State->bFinished.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+	FinishTween(State, true);
+	return true;
+}
+
+bool UCoreTweenWorldSubsystem::IsActive(const FCoreTweenHandle Handle) const
+{
+	const FCoreTweenState* State = Find(Handle);
+	return State && !State->bFinished.load(std::memory_order_acquire);
+}
+
 void UCoreTweenWorldSubsystem::PruneFinished()
 {
-	ActiveTweenStates.RemoveAll([](const TSharedPtr<FCoreTweenState>& State)
+	for (FCoreTweenBatch& Batch : Batches)
 	{
-		return State->bFinished.load(std::memory_order_acquire);
-	});
+		// Walk backwards so each swapped-in lane has already been visited.
+		for (int32 Lane = Batch.Num() - 1; Lane >= 0; --Lane)
+		{
+			if (Batch.States[Lane]->bFinished.load(std::memory_order_acquire))
+			{
+				Batch.RemoveAtSwap(Lane);
+			}
+		}
+	}
 }
@@ -19,3 +19,19 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
+
+#include "Targets/ActorTweenTarget.h"
+
+#include "GameFramework/Actor.h"
+
+FActorTweenTarget::FActorTweenTarget(AActor* InActor, const ETeleportType InTeleport)
+	: FSceneComponentTweenTarget(InActor ? InActor->GetRootComponent() : nullptr, InTeleport)
+	, Actor(InActor)
+{
+}
+
+bool FActorTweenTarget::IsTargetValid() const
+{
+	const AActor* TargetActor = Actor.Get();
+	return TargetActor && !TargetActor->IsActorBeingDestroyed() && FSceneComponentTweenTarget::IsTargetValid();
+}
@@ -0,0 +1,119 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Targets/MaterialTweenTarget.h"
+
+#include "CoreTweenMaterialParameterBuffer.h"
+#include "Materials/MaterialInstanceDynamic.h"
+
+FMaterialTweenTarget::FMaterialTweenTarget(UMaterialInstanceDynamic* InMaterial, const FName InParameterName)
+	: Material(InMaterial)
+	, ParameterName(InParameterName)
+{
+}
+
+bool FMaterialTweenTarget::IsTargetValid() const
+{
+	return Material.IsValid();
+}
+
+float FMaterialTweenTarget::GetCurrentMaterialScalar() const
+{
+	float Value = 0.0f;
+	if (const UMaterialInstanceDynamic* MID = Material.Get())
+	{
+		// A write merged earlier in this batch has not reached the instance yet.
+		if (const FCoreTweenMaterialParameterBuffer* Buffer = FCoreTweenMaterialParameterBuffer::GetActive())
+		{
+			if (const float* Pending = Buffer->FindScalar(MID, ParameterName))
+			{
+				return *Pending;
+			}
+		}
+		MID->GetScalarParameterValue(FHashedMaterialParameterInfo(ParameterName), Value);
+	}
+	return Value;
+}
+
+FLinearColor FMaterialTweenTarget::GetCurrentMaterialVector() const
+{
+	FLinearColor Value = FLinearColor::Black;
+	if (const UMaterialInstanceDynamic* MID = Material.Get())
+	{
+		if (const FCoreTweenMaterialParameterBuffer* Buffer = FCoreTweenMaterialParameterBuffer::GetActive())
+		{
+			if (const FLinearColor* Pending = Buffer->FindVector(MID, ParameterName))
+			{
+				return *Pending;
+			}
+		}
+		MID->GetVectorParameterValue(FHashedMaterialParameterInfo(ParameterName), Value);
+	}
+	return Value;
+}
+
+void FMaterialTweenTarget::ApplyMaterialScalar(const float Value)
+{
+	UMaterialInstanceDynamic* MID = Material.Get();
+	if (!MID)
+	{
+		return;
+	}
+
+	// The first write adds the parameter to the instance with this value and caches its slot.
+	if (ScalarIndex == INDEX_NONE)
+	{
+		MID->InitializeScalarParameterAndGetIndex(ParameterName, Value, ScalarIndex);
+		return;
+	}
+
+	if (FCoreTweenMaterialParameterBuffer* Buffer = FCoreTweenMaterialParameterBuffer::GetActive())
+	{
+		Buffer->MergeScalar(MID, ScalarIndex, ParameterName, Value);
+		return;
+	}
+
+	FCoreTweenMaterialParameterBuffer::WriteScalar(MID, ScalarIndex, ParameterName, Value);
+}
+
+void FMaterialTweenTarget::ApplyMaterialVector(const FLinearColor& Value)
+{
+	UMaterialInstanceDynamic* MID = Material.Get();
+	if (!MID)
+	{
+		return;
+	}
+
+	if (VectorIndex == INDEX_NONE)
+	{
+		MID->InitializeVectorParameterAndGetIndex(ParameterName, Value, VectorIndex);
+		return;
+	}
+
+	if (FCoreTweenMaterialParameterBuffer* Buffer = FCoreTweenMaterialParameterBuffer::GetActive())
+	{
+		Buffer->MergeVector(MID, VectorIndex, ParameterName, Value);
+		return;
+	}
+
+	FCoreTweenMaterialParameterBuffer::WriteVector(MID, VectorIndex, ParameterName, Value);
+}
@@ -0,0 +1,129 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Targets/MemoryTweenTarget.h"
+
+void FMemoryTweenTarget::ApplyTranslation(const FVector2D& Value)
+{
+	Translation = Value;
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyScale(const FVector2D& Value)
+{
+	Scale = Value;
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyOpacity(const float Value)
+{
+	Opacity = Value;
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyColor(const FLinearColor& Value)
+{
+	Color = Value;
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyRotation(const float Value)
+{
+	Rotation = Value;
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyCanvasPosition(const FVector2D& Value)
+{
+	CanvasPosition = Value;
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyPadding(const FVector4& Value)
+{
+	Padding = Value;
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyVisibility(const ESlateVisibility Value)
+{
+	Visibility = Value;
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyMaxDesiredHeight(const float Value)
+{
+	MaxDesiredHeight = Value;
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyRenderTransform(const FCoreTweenRenderTransform& Value)
+{
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Translation))
+	{
+		Translation = Value.Translation;
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Scale))
+	{
+		Scale = Value.Scale;
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Rotation))
+	{
+		Rotation = Value.Angle;
+	}
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyWorldTransform(const FCoreTweenWorldTransform& Value)
+{
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Location))
+	{
+		Location = Value.Location;
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Orientation))
+	{
+		Orientation = Value.Rotation;
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Scale3D))
+	{
+		Scale3D = Value.Scale3D;
+	}
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyRelativeTransform(const FTransform& Value)
+{
+	RelativeTransform = Value;
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyMaterialScalar(const float Value)
+{
+	MaterialScalar = Value;
+	++NumWrites;
+}
+
+void FMemoryTweenTarget::ApplyMaterialVector(const FLinearColor& Value)
+{
+	MaterialVector = Value;
+	++NumWrites;
+}
@@ -19,3 +19,138 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
+
+#include "Targets/SceneComponentTweenTarget.h"
+
+#include "CoreTweenComponentTransformBuffer.h"
+#include "Components/SceneComponent.h"
+
+namespace
+{
+	/**
+	 * Transforms waiting in the open batch. Completion callbacks run inside the batch,
+	 * so a tween started from one has to read the write the finishing tween just merged.
+	 */
+	bool FindPendingTransform(const USceneComponent* SceneComponent, FTransform& OutWorld, FTransform& OutRelative)
+	{
+		const FCoreTweenComponentTransformBuffer* Buffer = FCoreTweenComponentTransformBuffer::GetActive();
+		return Buffer && Buffer->Find(SceneComponent, OutWorld, OutRelative);
+	}
+} // namespace
+
+FSceneComponentTweenTarget::FSceneComponentTweenTarget(USceneComponent* InComponent, const ETeleportType InTeleport)
+	: Component(InComponent)
+	, Teleport(InTeleport)
+{
+}
+
+bool FSceneComponentTweenTarget::IsTargetValid() const
+{
+	return Component.IsValid();
+}
+
+bool FSceneComponentTweenTarget::IsRelevant(const FCoreTweenRelevanceContext& Context, ECoreTweenProperty AnimatedProperties) const
+{
+	const USceneComponent* SceneComponent = Component.Get();
+	if (!SceneComponent)
+	{
+		return false;
+	}
+
+	if (Context.MaxViewDistanceSquared <= 0.0 || Context.ViewLocations.IsEmpty())
+	{
+		return true;
+	}
+
+	const FVector Location = SceneComponent->GetComponentLocation();
+	for (const FVector& ViewLocation : Context.ViewLocations)
+	{
+		if (FVector::DistSquared(Location, ViewLocation) <= Context.MaxViewDistanceSquared)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+FVector FSceneComponentTweenTarget::GetCurrentLocation() const
+{
+	const USceneComponent* SceneComponent = Component.Get();
+	if (!SceneComponent)
+	{
+		return FVector::ZeroVector;
+	}
+	FTransform World;
+	FTransform Relative;
+	return FindPendingTransform(SceneComponent, World, Relative) ? World.GetLocation() : SceneComponent->GetComponentLocation();
+}
+
+FQuat FSceneComponentTweenTarget::GetCurrentOrientation() const
+{
+	const USceneComponent* SceneComponent = Component.Get();
+	if (!SceneComponent)
+	{
+		return FQuat::Identity;
+	}
+	FTransform World;
+	FTransform Relative;
+	return FindPendingTransform(SceneComponent, World, Relative) ? World.GetRotation() : SceneComponent->GetComponentQuat();
+}
+
+FVector FSceneComponentTweenTarget::GetCurrentScale3D() const
+{
+	const USceneComponent* SceneComponent = Component.Get();
+	if (!SceneComponent)
+	{
+		return FVector::OneVector;
+	}
+	FTransform World;
+	FTransform Relative;
+	return FindPendingTransform(SceneComponent, World, Relative) ? World.GetScale3D() : SceneComponent->GetComponentScale();
+}
+
+FTransform FSceneComponentTweenTarget::GetCurrentRelativeTransform() const
+{
+	const USceneComponent* SceneComponent = Component.Get();
+	if (!SceneComponent)
+	{
+		return FTransform::Identity;
+	}
+	FTransform World;
+	FTransform Relative;
+	return FindPendingTransform(SceneComponent, World, Relative) ? Relative : SceneComponent->GetRelativeTransform();
+}
+
+void FSceneComponentTweenTarget::ApplyWorldTransform(const FCoreTweenWorldTransform& Value)
+{
+	USceneComponent* SceneComponent = Component.Get();
+	if (!SceneComponent)
+	{
+		return;
+	}
+
+	if (FCoreTweenComponentTransformBuffer* Buffer = FCoreTweenComponentTransformBuffer::GetActive())
+	{
+		Buffer->MergeWorld(SceneComponent, Value, Teleport);
+		return;
+	}
+
+	FCoreTweenComponentTransformBuffer::WriteWorld(SceneComponent, Value, Teleport);
+}
+
+void FSceneComponentTweenTarget::ApplyRelativeTransform(const FTransform& Value)
+{
+	USceneComponent* SceneComponent = Component.Get();
+	if (!SceneComponent)
+	{
+		return;
+	}
+
+	if (FCoreTweenComponentTransformBuffer* Buffer = FCoreTweenComponentTransformBuffer::GetActive())
+	{
+		Buffer->MergeRelative(SceneComponent, Value, Teleport);
+		return;
+	}
+
+	SceneComponent->SetRelativeTransform(Value, false, nullptr, Teleport);
+}
@@ -0,0 +1,208 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Targets/SlateWidgetTweenTarget.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Components/Border.h"
+#include "Components/Image.h"
+#include "Components/Widget.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/SCompoundWidget.h"
+
+FSlateWidgetTweenState::FSlateWidgetTweenState(UWidget* InWidget)
+	: Widget(InWidget)
+{
+	if (!InWidget)
+	{
+		return;
+	}
+
+	Transform = InWidget->GetRenderTransform();
+	if (const UImage* Image = Cast<UImage>(InWidget))
+	{
+		Color = Image->GetColorAndOpacity();
+	}
+	else if (const UUserWidget* UserWidget = Cast<UUserWidget>(InWidget))
+	{
+		Color = UserWidget->GetColorAndOpacity();
+	}
+	else if (const UBorder* Border = Cast<UBorder>(InWidget))
+	{
+		Color = Border->GetContentColorAndOpacity();
+	}
+}
+
+FSlateWidgetTweenTarget::FSlateWidgetTweenTarget(UWidget* InWidget, TSharedPtr<FSlateWidgetTweenState> InState)
+	: FWidgetTweenTarget(InWidget)
+	, State(InState.IsValid() ? InState.ToSharedRef() : MakeShared<FSlateWidgetTweenState>(InWidget))
+{
+	if (!InWidget)
+	{
+		return;
+	}
+
+	WeakSlateWidget = InWidget->GetCachedWidget();
+
+	// UUserWidget and UBorder are backed by compound widgets (SObjectWidget, SBorder), whose
+	// SetColorAndOpacity is what their UMG setters forward to.
+	if (InWidget->IsA<UImage>())
+	{
+		ColorSink = EColorSink::Image;
+	}
+	else if (InWidget->IsA<UUserWidget>() || InWidget->IsA<UBorder>())
+	{
+		ColorSink = EColorSink::Compound;
+	}
+}
+
+SWidget* FSlateWidgetTweenTarget::ResolveSlateWidget()
+{
+	if (TSharedPtr<SWidget> SlateWidget = WeakSlateWidget.Pin())
+	{
+		return SlateWidget.Get();
+	}
+
+	UWidget* W = GetWidget();
+	if (!W)
+	{
+		return nullptr;
+	}
+	TSharedPtr<SWidget> SlateWidget = W->GetCachedWidget();
+	WeakSlateWidget = SlateWidget;
+	return SlateWidget.Get();
+}
+
+// -- Read current values ---------------------------------------------
+
+FVector2D FSlateWidgetTweenTarget::GetCurrentTranslation() const
+{
+	return State->Transform.Translation;
+}
+
+FVector2D FSlateWidgetTweenTarget::GetCurrentScale() const
+{
+	return State->Transform.Scale;
+}
+
+float FSlateWidgetTweenTarget::GetCurrentOpacity() const
+{
+	const TSharedPtr<SWidget> SlateWidget = WeakSlateWidget.Pin();
+	return SlateWidget.IsValid() ? SlateWidget->GetRenderOpacity() : FWidgetTweenTarget::GetCurrentOpacity();
+}
+
+FLinearColor FSlateWidgetTweenTarget::GetCurrentColor() const
+{
+	return State->Color;
+}
+
+float FSlateWidgetTweenTarget::GetCurrentRotation() const
+{
+	return State->Transform.Angle;
+}
+
+// -- Apply interpolated values ---------------------------------------
+
+void FSlateWidgetTweenTarget::WriteRenderTransform()
+{
+	SWidget* SlateWidget = ResolveSlateWidget();
+	if (!SlateWidget)
+	{
+		return;
+	}
+
+	if (State->Transform.IsIdentity())
+	{
+		SlateWidget->SetRenderTransform(TOptional<FSlateRenderTransform>());
+	}
+	else
+	{
+		SlateWidget->SetRenderTransform(State->Transform.ToSlateRenderTransform());
+	}
+}
+
+void FSlateWidgetTweenTarget::ApplyTranslation(const FVector2D& Value)
+{
+	State->Transform.Translation = Value;
+	WriteRenderTransform();
+}
+
+void FSlateWidgetTweenTarget::ApplyScale(const FVector2D& Value)
+{
+	State->Transform.Scale = Value;
+	WriteRenderTransform();
+}
+
+void FSlateWidgetTweenTarget::ApplyRotation(const float Value)
+{
+	State->Transform.Angle = Value;
+	WriteRenderTransform();
+}
+
+void FSlateWidgetTweenTarget::ApplyRenderTransform(const FCoreTweenRenderTransform& Value)
+{
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Translation))
+	{
+		State->Transform.Translation = Value.Translation;
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Scale))
+	{
+		State->Transform.Scale = Value.Scale;
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Rotation))
+	{
+		State->Transform.Angle = Value.Angle;
+	}
+	WriteRenderTransform();
+}
+
+void FSlateWidgetTweenTarget::ApplyOpacity(const float Value)
+{
+	if (SWidget* SlateWidget = ResolveSlateWidget())
+	{
+		SlateWidget->SetRenderOpacity(Value);
+	}
+}
+
+void FSlateWidgetTweenTarget::ApplyColor(const FLinearColor& Value)
+{
+	State->Color = Value;
+
+	SWidget* SlateWidget = ResolveSlateWidget();
+	if (!SlateWidget)
+	{
+		return;
+	}
+
+	switch (ColorSink)
+	{
+		case EColorSink::Image:
+			static_cast<SImage*>(SlateWidget)->SetColorAndOpacity(Value);
+			break;
+		case EColorSink::Compound:
+			static_cast<SCompoundWidget*>(SlateWidget)->SetColorAndOpacity(Value);
+			break;
+		case EColorSink::None:
+		default:
+			break;
+	}
+}
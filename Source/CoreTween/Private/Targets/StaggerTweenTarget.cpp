@@ -0,0 +1,326 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Targets/StaggerTweenTarget.h"
+
+#include "CoreTweenEasing.h"
+#include "CoreTweenEasingLUT.h"
+#include "CoreTweenProperty.h"
+#include "Components/Widget.h"
+
+namespace
+{
+	/** Launch rank of widget Index out of Num; offsets are Rank * StaggerDelay. Random is handled by the caller. */
+	int32 GetStaggerRank(const ECoreTweenStaggerOrder Order, const int32 Index, const int32 Num)
+	{
+		// Twice the distance from the middle, so odd and even counts both rank in whole steps.
+		const int32 FromCenter = FMath::Abs(2 * Index - (Num - 1)) / 2;
+		switch (Order)
+		{
+			case ECoreTweenStaggerOrder::LastToFirst: return Num - 1 - Index;
+			case ECoreTweenStaggerOrder::FromCenter: return FromCenter;
+			case ECoreTweenStaggerOrder::FromEdges: return (Num - 1) / 2 - FromCenter;
+			default: return Index;
+		}
+	}
+
+	/** Fill Values from each widget, unless Prop has both a start and a target and nothing differs per widget. */
+	template <typename PropType, typename T, typename ReadFunc>
+	void CaptureValues(const PropType& Prop, TArray<T>& Values, const TArray<TWeakObjectPtr<UWidget>>& Widgets, FWidgetTweenTarget& Reader, ReadFunc&& Read)
+	{
+		Values.Reset();
+		if (Prop.bHasStart && Prop.bHasTarget)
+		{
+			return;
+		}
+		Values.Reserve(Widgets.Num());
+		for (const TWeakObjectPtr<UWidget>& Widget : Widgets)
+		{
+			Reader.SetWidget(Widget.Get());
+			Values.Add(Reader.IsTargetValid() ? Read(Reader) : (Prop.bHasStart ? Prop.StartValue : Prop.TargetValue));
+		}
+		Reader.SetWidget(nullptr);
+	}
+
+	template <typename PropType, typename T>
+	FORCEINLINE T LerpValue(const PropType& Prop, const TArray<T>& Values, const int32 Index, const float EasedAlpha)
+	{
+		const T& Start = Prop.bHasStart ? Prop.StartValue : Values[Index];
+		const T& Target = Prop.bHasTarget ? Prop.TargetValue : Values[Index];
+		return CoreTweenMath::Lerp(Start, Target, EasedAlpha);
+	}
+
+	/** Discrete counterpart of LerpValue(): the start until the widget's alpha reaches 1. */
+	template <typename PropType, typename T>
+	FORCEINLINE T SnapValue(const PropType& Prop, const TArray<T>& Values, const int32 Index, const float EasedAlpha)
+	{
+		if (EasedAlpha >= 1.0f)
+		{
+			return Prop.bHasTarget ? Prop.TargetValue : Values[Index];
+		}
+		return Prop.bHasStart ? Prop.StartValue : Values[Index];
+	}
+}
+
+FStaggerTweenTarget::FStaggerTweenTarget(const TArrayView<UWidget* const> InWidgets, const float StaggerDelay, const ECoreTweenStaggerOrder Order)
+	: Writer(nullptr)
+{
+	const int32 Count = InWidgets.Num();
+	Widgets.Reserve(Count);
+	for (UWidget* Widget : InWidgets)
+	{
+		Widgets.Add(Widget);
+	}
+
+	TArray<int32> Ranks;
+	Ranks.SetNumUninitialized(Count);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Ranks[Index] = GetStaggerRank(Order, Index, Count);
+	}
+	if (Order == ECoreTweenStaggerOrder::Random)
+	{
+		for (int32 Index = Count - 1; Index > 0; --Index)
+		{
+			Ranks.Swap(Index, FMath::RandRange(0, Index));
+		}
+	}
+
+	const float Delay = FMath::Max(StaggerDelay, 0.0f);
+	Offsets.SetNumUninitialized(Count);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Offsets[Index] = Ranks[Index] * Delay;
+		Span = FMath::Max(Span, Offsets[Index]);
+	}
+
+	Alpha.SetNumZeroed(Count);
+	WrittenAlpha.Init(-1.0f, Count);
+}
+
+bool FStaggerTweenTarget::IsTargetValid() const
+{
+	for (const TWeakObjectPtr<UWidget>& Widget : Widgets)
+	{
+		if (Widget.IsValid())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FStaggerTweenTarget::GetExtraTargetObjects(TArray<UObject*>& OutObjects) const
+{
+	OutObjects.Reserve(OutObjects.Num() + Widgets.Num());
+	for (const TWeakObjectPtr<UWidget>& Widget : Widgets)
+	{
+		if (UWidget* Live = Widget.Get())
+		{
+			OutObjects.Add(Live);
+		}
+	}
+}
+
+bool FStaggerTweenTarget::ReleaseTargetObject(const UObject* Object)
+{
+	// Null the entry rather than removing it, so the per-widget columns stay parallel. Writes skip dead entries.
+	for (TWeakObjectPtr<UWidget>& Widget : Widgets)
+	{
+		if (Widget.Get() == Object)
+		{
+			Widget.Reset();
+		}
+	}
+	return IsTargetValid();
+}
+
+void FStaggerTweenTarget::OnTweenLaunched(FCoreTweenState& State)
+{
+	// Each widget eases on its own; the driver only measures group time.
+	ItemDuration = FMath::Max(State.Duration, 0.0f);
+	State.Duration = ItemDuration + Span;
+	EasingType = State.EasingType;
+	EasingCurve = State.EasingCurve;
+	Params.Init(State.EasingParam.Get(FCoreTweenEasing::GetDefaultParam(EasingType)), Widgets.Num());
+	State.EasingType = ECoreTweenEasingType::Linear;
+	State.EasingParam.Reset();
+	State.EasingCurve.Reset();
+	State.bFollow = false;
+	State.Applier = &FStaggerTweenTarget::Apply;
+
+	const ECoreTweenProperty Mask = State.PropertyMask;
+	if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Translation))
+	{
+		CaptureValues(State.Properties.Get<ECoreTweenProperty::Translation>(), TranslationValues, Widgets, Writer, [](const FWidgetTweenTarget& T) { return T.GetCurrentTranslation(); });
+	}
+	if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Scale))
+	{
+		CaptureValues(State.Properties.Get<ECoreTweenProperty::Scale>(), ScaleValues, Widgets, Writer, [](const FWidgetTweenTarget& T) { return T.GetCurrentScale(); });
+	}
+	if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Color))
+	{
+		CaptureValues(State.Properties.Get<ECoreTweenProperty::Color>(), ColorValues, Widgets, Writer, [](const FWidgetTweenTarget& T) { return T.GetCurrentColor(); });
+	}
+	if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Opacity))
+	{
+		CaptureValues(State.Properties.Get<ECoreTweenProperty::Opacity>(), OpacityValues, Widgets, Writer, [](const FWidgetTweenTarget& T) { return T.GetCurrentOpacity(); });
+	}
+	if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Rotation))
+	{
+		CaptureValues(State.Properties.Get<ECoreTweenProperty::Rotation>(), RotationValues, Widgets, Writer, [](const FWidgetTweenTarget& T) { return T.GetCurrentRotation(); });
+	}
+	if (EnumHasAnyFlags(Mask, ECoreTweenProperty::CanvasPosition))
+	{
+		CaptureValues(State.Properties.Get<ECoreTweenProperty::CanvasPosition>(), CanvasPositionValues, Widgets, Writer, [](const FWidgetTweenTarget& T) { return T.GetCurrentCanvasPosition(); });
+	}
+	if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Padding))
+	{
+		CaptureValues(State.Properties.Get<ECoreTweenProperty::Padding>(), PaddingValues, Widgets, Writer, [](const FWidgetTweenTarget& T) { return T.GetCurrentPadding(); });
+	}
+	if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Visibility))
+	{
+		CaptureValues(State.Properties.Get<ECoreTweenProperty::Visibility>(), VisibilityValues, Widgets, Writer, [](const FWidgetTweenTarget& T) { return T.GetCurrentVisibility(); });
+	}
+	if (EnumHasAnyFlags(Mask, ECoreTweenProperty::MaxDesiredHeight))
+	{
+		CaptureValues(State.Properties.Get<ECoreTweenProperty::MaxDesiredHeight>(), MaxDesiredHeightValues, Widgets, Writer, [](const FWidgetTweenTarget& T) { return T.GetCurrentMaxDesiredHeight(); });
+	}
+}
+
+void FStaggerTweenTarget::Apply(FCoreTweenState& State, const float EasedAlpha, const ECoreTweenApplyPhase Phase)
+{
+	FStaggerTweenTarget& Group = static_cast<FStaggerTweenTarget&>(*State.Target);
+	if (EnumHasAnyFlags(Phase, ECoreTweenApplyPhase::Evaluate))
+	{
+		Group.Evaluate(State, EasedAlpha * State.Duration);
+	}
+	if (EnumHasAnyFlags(Phase, ECoreTweenApplyPhase::Write))
+	{
+		Group.Write(State);
+	}
+}
+
+void FStaggerTweenTarget::Evaluate(FCoreTweenState& State, const float Time)
+{
+	const int32 Count = Widgets.Num();
+	float* AlphaData = Alpha.GetData();
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const float Local = Time - Offsets[Index];
+		AlphaData[Index] = ItemDuration > 0.0f ? FMath::Clamp(Local / ItemDuration, 0.0f, 1.0f) : (Local >= 0.0f ? 1.0f : 0.0f);
+	}
+
+	if (EasingType == ECoreTweenEasingType::Curve)
+	{
+		if (EasingCurve)
+		{
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				AlphaData[Index] = EasingCurve->Sample(AlphaData[Index]);
+			}
+		}
+	}
+	else
+	{
+		FCoreTweenEasing::EaseBatch(EasingType, AlphaData, Params.GetData(), Count);
+	}
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		if (AlphaData[Index] != WrittenAlpha[Index])
+		{
+			State.DirtyMask = State.PropertyMask;
+			return;
+		}
+	}
+}
+
+void FStaggerTweenTarget::Write(FCoreTweenState& State)
+{
+	if (State.DirtyMask == ECoreTweenProperty::None)
+	{
+		return;
+	}
+	State.DirtyMask = ECoreTweenProperty::None;
+
+	const ECoreTweenProperty Mask = State.PropertyMask;
+	const ECoreTweenProperty TransformMask = Mask & (ECoreTweenProperty::Translation | ECoreTweenProperty::Scale | ECoreTweenProperty::Rotation);
+	for (int32 Index = 0; Index < Widgets.Num(); ++Index)
+	{
+		const float A = Alpha[Index];
+		if (A == WrittenAlpha[Index])
+		{
+			continue;
+		}
+		Writer.SetWidget(Widgets[Index].Get());
+		if (!Writer.IsTargetValid())
+		{
+			continue;
+		}
+		WrittenAlpha[Index] = A;
+
+		if (TransformMask != ECoreTweenProperty::None)
+		{
+			FCoreTweenRenderTransform Transform;
+			Transform.Components = TransformMask;
+			if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Translation))
+			{
+				Transform.Translation = LerpValue(State.Properties.Get<ECoreTweenProperty::Translation>(), TranslationValues, Index, A);
+			}
+			if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Scale))
+			{
+				Transform.Scale = LerpValue(State.Properties.Get<ECoreTweenProperty::Scale>(), ScaleValues, Index, A);
+			}
+			if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Rotation))
+			{
+				Transform.Angle = LerpValue(State.Properties.Get<ECoreTweenProperty::Rotation>(), RotationValues, Index, A);
+			}
+			Writer.ApplyRenderTransform(Transform);
+		}
+		if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Color))
+		{
+			Writer.ApplyColor(LerpValue(State.Properties.Get<ECoreTweenProperty::Color>(), ColorValues, Index, A));
+		}
+		if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Opacity))
+		{
+			Writer.ApplyOpacity(LerpValue(State.Properties.Get<ECoreTweenProperty::Opacity>(), OpacityValues, Index, A));
+		}
+		if (EnumHasAnyFlags(Mask, ECoreTweenProperty::CanvasPosition))
+		{
+			Writer.ApplyCanvasPosition(LerpValue(State.Properties.Get<ECoreTweenProperty::CanvasPosition>(), CanvasPositionValues, Index, A));
+		}
+		if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Padding))
+		{
+			Writer.ApplyPadding(LerpValue(State.Properties.Get<ECoreTweenProperty::Padding>(), PaddingValues, Index, A));
+		}
+		if (EnumHasAnyFlags(Mask, ECoreTweenProperty::MaxDesiredHeight))
+		{
+			Writer.ApplyMaxDesiredHeight(LerpValue(State.Properties.Get<ECoreTweenProperty::MaxDesiredHeight>(), MaxDesiredHeightValues, Index, A));
+		}
+		if (EnumHasAnyFlags(Mask, ECoreTweenProperty::Visibility))
+		{
+			Writer.ApplyVisibility(SnapValue(State.Properties.Get<ECoreTweenProperty::Visibility>(), VisibilityValues, Index, A));
+		}
+	}
+	Writer.SetWidget(nullptr);
+}
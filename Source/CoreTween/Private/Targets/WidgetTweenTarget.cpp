@@ -1,4 +1,4 @@
-// MIT License
+﻿// MIT License
 //
 // Copyright (c) 2026 Jos� M. Nieves
 //
@@ -22,7 +22,9 @@
 
 #include "Targets/WidgetTweenTarget.h"
 
+#include "CoreTweenRenderTransformBuffer.h"
 #include "Blueprint/UserWidget.h"
+#include "CommonActivatableWidget.h"
 #include "Components/Border.h"
 #include "Components/CanvasPanelSlot.h"
 #include "Components/HorizontalBoxSlot.h"
@@ -34,6 +36,26 @@
 
 DEFINE_LOG_CATEGORY(LogCoreTweenTarget);
 
+namespace
+{
+	/**
+	 * The render transform the widget will have once the open batch flushes. Completion
+	 * callbacks run inside the batch, so a tween started from one must see the write
+	 * the finishing tween just merged, not last frame's transform.
+	 */
+	FWidgetTransform GetPendingRenderTransform(const UWidget* Widget)
+	{
+		if (const FCoreTweenRenderTransformBuffer* Buffer = FCoreTweenRenderTransformBuffer::GetActive())
+		{
+			if (const FWidgetTransform* Pending = Buffer->Find(Widget))
+			{
+				return *Pending;
+			}
+		}
+		return Widget->GetRenderTransform();
+	}
+} // namespace
+
 FWidgetTweenTarget::FWidgetTweenTarget(UWidget* InWidget)
 	: WeakWidget(InWidget)
 {
@@ -49,18 +71,81 @@ UWidget* FWidgetTweenTarget::GetWidget() const
 	return WeakWidget.Get();
 }
 
+void FWidgetTweenTarget::SetWidget(UWidget* InWidget)
+{
+	WeakWidget = InWidget;
+}
+
+bool FWidgetTweenTarget::IsRelevant(const FCoreTweenRelevanceContext& Context, const ECoreTweenProperty AnimatedProperties) const
+{
+	const UWidget* W = WeakWidget.Get();
+	if (!W)
+	{
+		return false;
+	}
+
+	// Walk up through panels and owning user widgets. The tweened widget itself
+	// is exempt from any test on a property the tween animates (e.g. a fade in
+	// from 0 or an outro on a deactivated screen).
+	constexpr int32 MaxDepth = 64;
+	int32 Depth = 0;
+	for (const UWidget* Current = W; Current && Depth < MaxDepth; ++Depth)
+	{
+		const bool bSelf = Current == W;
+
+		const ESlateVisibility Visibility = Current->GetVisibility();
+		const bool bHidden = Visibility == ESlateVisibility::Collapsed || Visibility == ESlateVisibility::Hidden;
+		if (bHidden && !(bSelf && EnumHasAnyFlags(AnimatedProperties, ECoreTweenProperty::Visibility)))
+		{
+			return false;
+		}
+
+		if (Current->GetRenderOpacity() <= 0.0f && !(bSelf && EnumHasAnyFlags(AnimatedProperties, ECoreTweenProperty::Opacity | ECoreTweenProperty::Color)))
+		{
+			return false;
+		}
+
+		if (!bSelf)
+		{
+			const UCommonActivatableWidget* Activatable = Cast<UCommonActivatableWidget>(Current);
+			if (Activatable && !Activatable->IsActivated())
+			{
+				return false;
+			}
+		}
+
+		const UWidget* Parent = Current->GetParent();
+		Current = Parent ? Parent : Current->GetTypedOuter<UUserWidget>();
+	}
+
+	// Off-screen: only meaningful once the widget has been laid out.
+	if (Context.ViewportRect.GetArea() > 0.0f)
+	{
+		const FGeometry& Geometry = W->GetCachedGeometry();
+		if (Geometry.GetLocalSize().X > 0.0f && Geometry.GetLocalSize().Y > 0.0f)
+		{
+			const FSlateRect Bounds = Geometry.GetLayoutBoundingRect();
+			if (!FSlateRect::DoRectanglesIntersect(Bounds, Context.ViewportRect))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
 // -- Read current values ---------------------------------------------
 
 FVector2D FWidgetTweenTarget::GetCurrentTranslation() const
 {
 	UWidget* W = WeakWidget.Get();
-	return W ? W->GetRenderTransform().Translation : FVector2D::ZeroVector;
+	return W ? GetPendingRenderTransform(W).Translation : FVector2D::ZeroVector;
 }
 
 FVector2D FWidgetTweenTarget::GetCurrentScale() const
 {
 	UWidget* W = WeakWidget.Get();
-	return W ? W->GetRenderTransform().Scale : FVector2D::UnitVector;
+	return W ? GetPendingRenderTransform(W).Scale : FVector2D::UnitVector;
 }
 
 float FWidgetTweenTarget::GetCurrentOpacity() const
@@ -94,7 +179,7 @@ FLinearColor FWidgetTweenTarget::GetCurrentColor() const
 float FWidgetTweenTarget::GetCurrentRotation() const
 {
 	UWidget* W = WeakWidget.Get();
-	return W ? W->GetRenderTransform().Angle : 0.0f;
+	return W ? GetPendingRenderTransform(W).Angle : 0.0f;
 }
 
 FVector2D FWidgetTweenTarget::GetCurrentCanvasPosition() const
@@ -289,3 +374,32 @@ void FWidgetTweenTarget::ApplyMaxDesiredHeight(const float Value)
 	}
 }
 
+void FWidgetTweenTarget::ApplyRenderTransform(const FCoreTweenRenderTransform& Value)
+{
+	UWidget* W = WeakWidget.Get();
+	if (!W)
+	{
+		return;
+	}
+
+	if (FCoreTweenRenderTransformBuffer* Buffer = FCoreTweenRenderTransformBuffer::GetActive())
+	{
+		Buffer->Merge(W, Value);
+		return;
+	}
+
+	FWidgetTransform Transform = W->GetRenderTransform();
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Translation))
+	{
+		Transform.Translation = Value.Translation;
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Scale))
+	{
+		Transform.Scale = Value.Scale;
+	}
+	if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Rotation))
+	{
+		Transform.Angle = Value.Angle;
+	}
+	W->SetRenderTransform(Transform);
+}
@@ -0,0 +1,297 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CoreTweenBenchmarkCommandlet.h"
+#include "CoreTweenBuilder.h"
+#include "CoreTweenEasing.h"
+#include "CoreTweenSimulation.h"
+#include "CoreTweenTimeline.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Targets/MemoryTweenTarget.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Headless checks of the tween core: FCoreTweenSimulation drives the same batch
+ * kernels and state machine as UCoreTweenWorldSubsystem, against FMemoryTweenTarget.
+ * Deltas are powers of two so elapsed time accumulates exactly.
+ */
+namespace CoreTweenSimulationTests
+{
+	constexpr float Step = 0.25f;
+
+	/** Linear 0 -> 1 opacity tween on Target, counting OnComplete calls into Completions. */
+	FCoreTweenBuilder MakeOpacityTween(const TSharedRef<FMemoryTweenTarget>& Target, const float Duration, int32& Completions)
+	{
+		FCoreTweenBuilder Builder(Target, nullptr, Duration, 0.0f, false);
+		Builder.FromOpacity(0.0f)
+			.ToOpacity(1.0f)
+			.Easing(ECoreTweenEasingType::Linear)
+			.OnComplete(FCoreTweenSignature::CreateLambda([&Completions]() { ++Completions; }));
+		return Builder;
+	}
+
+	void TickFor(FCoreTweenSimulation& Simulation, const float Seconds)
+	{
+		for (float Elapsed = 0.0f; Elapsed < Seconds; Elapsed += Step)
+		{
+			Simulation.Tick(Step);
+		}
+	}
+} // namespace CoreTweenSimulationTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreTweenLoopLapsTest, "CoreTween.Simulation.Loops",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FCoreTweenLoopLapsTest::RunTest(const FString& Parameters)
+{
+	using namespace CoreTweenSimulationTests;
+
+	FCoreTweenSimulation Simulation;
+	TSharedRef<FMemoryTweenTarget> Target = MakeShared<FMemoryTweenTarget>();
+	int32 Completions = 0;
+
+	FCoreTweenBuilder Builder = MakeOpacityTween(Target, 0.5f, Completions);
+	Builder.SetLoops(3);
+	Simulation.Start(Builder);
+
+	// Each lap restarts from the From value.
+	TickFor(Simulation, 0.75f);
+	TestEqual(TEXT("Second lap restarted from From"), Target->Opacity, 0.5f, KINDA_SMALL_NUMBER);
+
+	TickFor(Simulation, 0.5f);
+	TestEqual(TEXT("Still running inside the third lap"), Simulation.Num(), 1);
+	TestEqual(TEXT("No completion before the last lap ends"), Completions, 0);
+
+	TickFor(Simulation, 0.5f);
+	TestEqual(TEXT("Finished after three laps"), Simulation.Num(), 0);
+	TestEqual(TEXT("OnComplete fired once"), Completions, 1);
+	TestEqual(TEXT("Landed on To"), Target->Opacity, 1.0f, KINDA_SMALL_NUMBER);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreTweenPingPongLapsTest, "CoreTween.Simulation.PingPong",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FCoreTweenPingPongLapsTest::RunTest(const FString& Parameters)
+{
+	using namespace CoreTweenSimulationTests;
+
+	FCoreTweenSimulation Simulation;
+	TSharedRef<FMemoryTweenTarget> Target = MakeShared<FMemoryTweenTarget>();
+	int32 Completions = 0;
+
+	// Two loops of a ping-pong are four laps: out, back, out, back.
+	FCoreTweenBuilder Builder = MakeOpacityTween(Target, 0.5f, Completions);
+	Builder.SetLoops(2).SetPingPong(true);
+	Simulation.Start(Builder);
+
+	TickFor(Simulation, 0.25f);
+	TestEqual(TEXT("First lap plays forward"), Target->Opacity, 0.5f, KINDA_SMALL_NUMBER);
+
+	TickFor(Simulation, 0.5f);
+	TestEqual(TEXT("Second lap plays backward"), Target->Opacity, 0.5f, KINDA_SMALL_NUMBER);
+
+	TickFor(Simulation, 1.0f);
+	TestEqual(TEXT("Still running inside the fourth lap"), Simulation.Num(), 1);
+	TestEqual(TEXT("No completion before the last lap ends"), Completions, 0);
+
+	TickFor(Simulation, 0.5f);
+	TestEqual(TEXT("Finished after four laps"), Simulation.Num(), 0);
+	TestEqual(TEXT("OnComplete fired once"), Completions, 1);
+	TestEqual(TEXT("A full ping-pong lands back on From"), Target->Opacity, 0.0f, KINDA_SMALL_NUMBER);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreTweenFromCurrentTest, "CoreTween.Simulation.FromCurrent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FCoreTweenFromCurrentTest::RunTest(const FString& Parameters)
+{
+	using namespace CoreTweenSimulationTests;
+
+	FCoreTweenSimulation Simulation;
+	TSharedRef<FMemoryTweenTarget> Target = MakeShared<FMemoryTweenTarget>();
+	Target->Opacity = 0.2f;
+	Target->Translation = FVector2D(100.0f, -40.0f);
+
+	// No From values: both properties start where the target is.
+	FCoreTweenBuilder Builder(Target, nullptr, 1.0f, 0.0f, false);
+	Builder.ToOpacity(1.0f)
+		.ToTranslation(FVector2D::ZeroVector)
+		.Easing(ECoreTweenEasingType::Linear);
+	Simulation.Start(Builder);
+
+	TickFor(Simulation, 0.5f);
+	TestEqual(TEXT("Opacity halfway from its current value"), Target->Opacity, 0.6f, KINDA_SMALL_NUMBER);
+	TestTrue(TEXT("Translation halfway from its current value"), Target->Translation.Equals(FVector2D(50.0f, -20.0f), KINDA_SMALL_NUMBER));
+
+	TickFor(Simulation, 0.5f);
+	TestEqual(TEXT("Opacity landed on To"), Target->Opacity, 1.0f, KINDA_SMALL_NUMBER);
+	TestTrue(TEXT("Translation landed on To"), Target->Translation.Equals(FVector2D::ZeroVector, KINDA_SMALL_NUMBER));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreTweenForceCompleteTest, "CoreTween.Simulation.ForceComplete",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FCoreTweenForceCompleteTest::RunTest(const FString& Parameters)
+{
+	using namespace CoreTweenSimulationTests;
+
+	FCoreTweenSimulation Simulation;
+	TSharedRef<FMemoryTweenTarget> Target = MakeShared<FMemoryTweenTarget>();
+	int32 Completions = 0;
+
+	// Eased, looping forever and mid-lap on the way back: completing must still land on To.
+	FCoreTweenBuilder Builder = MakeOpacityTween(Target, 1.0f, Completions);
+	Builder.Easing(ECoreTweenEasingType::EaseInOutCubic)
+		.FromScale(FVector2D(0.5f))
+		.ToScale(FVector2D(2.0f))
+		.SetLoops(-1)
+		.SetPingPong(true);
+	const FCoreTweenHandle Handle = Simulation.Start(Builder);
+
+	TickFor(Simulation, 1.5f);
+	TestTrue(TEXT("Complete() accepts a running tween"), Simulation.Complete(Handle));
+	Simulation.Tick(Step);
+
+	TestEqual(TEXT("Finished"), Simulation.Num(), 0);
+	TestEqual(TEXT("OnComplete fired once"), Completions, 1);
+	TestEqual(TEXT("Opacity landed on To"), Target->Opacity, 1.0f, KINDA_SMALL_NUMBER);
+	TestTrue(TEXT("Scale landed on To"), Target->Scale.Equals(FVector2D(2.0f), KINDA_SMALL_NUMBER));
+	TestFalse(TEXT("Complete() rejects a finished tween"), Simulation.Complete(Handle));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreTweenTimelineSeekTest, "CoreTween.Timeline.SeekAcrossShortTrack",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FCoreTweenTimelineSeekTest::RunTest(const FString& Parameters)
+{
+	// A long track over the whole timeline and a short later one on the same property.
+	TArray<FCoreTweenTimeline::FTrack> Tracks;
+	FCoreTweenTimeline::FTrack& Long = Tracks.AddDefaulted_GetRef();
+	Long.Template = FCoreTweenTimeline::Track(10.0f).FromOpacity(0.0f).ToOpacity(1.0f).Easing(ECoreTweenEasingType::Linear);
+	Long.StartTime = 0.0f;
+	Long.EndTime = 10.0f;
+	FCoreTweenTimeline::FTrack& Short = Tracks.AddDefaulted_GetRef();
+	Short.Template = FCoreTweenTimeline::Track(1.0f).FromOpacity(0.2f).ToOpacity(0.3f).Easing(ECoreTweenEasingType::Linear);
+	Short.StartTime = 1.0f;
+	Short.EndTime = 2.0f;
+
+	const TSharedRef<const FCoreTweenTimeline> Timeline = MakeShared<FCoreTweenTimeline>(MoveTemp(Tracks), TArray<FCoreTweenTimeline::FMarker>(), 10.0f);
+	TSharedRef<FMemoryTweenTarget> Target = MakeShared<FMemoryTweenTarget>();
+	const TSharedRef<FCoreTweenTimelinePlayer> Player = MakeShared<FCoreTweenTimelinePlayer>(Timeline, Target);
+
+	Player->Seek(5.0f);
+	TestEqual(TEXT("Finished short track does not overwrite the running long one"), Target->Opacity, 0.5f, KINDA_SMALL_NUMBER);
+
+	Player->Seek(1.5f);
+	TestEqual(TEXT("Running short track wins over the earlier long one"), Target->Opacity, 0.25f, KINDA_SMALL_NUMBER);
+
+	Player->Seek(8.0f);
+	TestEqual(TEXT("Seeking forward across the short track lands on the long one"), Target->Opacity, 0.8f, KINDA_SMALL_NUMBER);
+
+	Player->Seek(10.0f);
+	TestEqual(TEXT("The track that ends last wins at the end"), Target->Opacity, 1.0f, KINDA_SMALL_NUMBER);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreTweenEaseBatchParityTest, "CoreTween.Easing.BatchParity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FCoreTweenEaseBatchParityTest::RunTest(const FString& Parameters)
+{
+	// Not a multiple of the SIMD width, so the scalar tail is covered too.
+	constexpr int32 NumSamples = 67;
+	constexpr float Tolerance = 1.0e-4f;
+
+	TArray<float> Alphas;
+	TArray<float> Params;
+	Alphas.SetNumUninitialized(NumSamples);
+	Params.SetNumUninitialized(NumSamples);
+
+	// Curve lanes ease through a per-lane table and have no scalar counterpart.
+	for (int32 TypeIdx = 0; TypeIdx < FCoreTweenEasing::NumEasingTypes; ++TypeIdx)
+	{
+		const ECoreTweenEasingType Type = static_cast<ECoreTweenEasingType>(TypeIdx);
+		if (Type == ECoreTweenEasingType::Curve)
+		{
+			continue;
+		}
+
+		for (int32 Idx = 0; Idx < NumSamples; ++Idx)
+		{
+			Alphas[Idx] = static_cast<float>(Idx) / (NumSamples - 1);
+			Params[Idx] = FCoreTweenEasing::GetDefaultParam(Type);
+		}
+		FCoreTweenEasing::EaseBatch(Type, Alphas.GetData(), Params.GetData(), NumSamples);
+
+		for (int32 Idx = 0; Idx < NumSamples; ++Idx)
+		{
+			const float Alpha = static_cast<float>(Idx) / (NumSamples - 1);
+			const float Expected = FCoreTweenEasing::Ease(Type, Alpha);
+			if (!FMath::IsNearlyEqual(Alphas[Idx], Expected, Tolerance))
+			{
+				AddError(FString::Printf(TEXT("%s at alpha %.4f: EaseBatch %.6f, Ease %.6f"),
+					*UEnum::GetValueAsString(Type), Alpha, Alphas[Idx], Expected));
+				break;
+			}
+		}
+	}
+	return true;
+}
+
+#if WITH_EDITOR
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreTweenBenchmarkCommandletTest, "CoreTween.Benchmark.Commandlet",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCoreTweenBenchmarkCommandletTest::RunTest(const FString& Parameters)
+{
+	const FString OutputPath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("CoreTweenBenchmarkTest.csv"));
+	IFileManager::Get().Delete(*OutputPath);
+
+	UCoreTweenBenchmarkCommandlet* Commandlet = NewObject<UCoreTweenBenchmarkCommandlet>();
+	const int32 Result = Commandlet->Main(FString::Printf(TEXT("-Counts=4,8 -Properties=1,2 -Frames=2 -Output=\"%s\""), *OutputPath));
+	TestEqual(TEXT("Commandlet exit code"), Result, 0);
+
+	TArray<FString> Lines;
+	if (!TestTrue(TEXT("CSV was written"), FFileHelper::LoadFileToStringArray(Lines, *OutputPath)))
+	{
+		return false;
+	}
+	IFileManager::Get().Delete(*OutputPath);
+
+	// One row per tween count x property count x easing type, after the header.
+	TestEqual(TEXT("CSV header"), Lines.Num() > 0 ? Lines[0] : FString(), FString(TEXT("Tweens,Easing,Properties,Frames,NsPerTweenFrame")));
+	TestEqual(TEXT("CSV row count"), Lines.Num(), 1 + 2 * 2 * FCoreTweenEasing::NumEasingTypes);
+	return true;
+}
+
+#endif // WITH_EDITOR
+
+#endif // WITH_DEV_AUTOMATION_TESTS
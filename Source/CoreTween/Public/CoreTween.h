@@ -22,22 +22,32 @@
 
 #pragma once
 
+#include "CoreTweenApply.h"
 #include "CoreTweenBuilder.h"
 #include "CoreTweenEasing.h"
 #include "CoreTweenTypes.h"
+#include "Containers/ArrayView.h"
+#include "Engine/EngineTypes.h"
 #include "UObject/Object.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Templates/SharedPointer.h"
 
 #include "CoreTween.generated.h"
 
+class AActor;
+class UImage;
+class UMaterialInstanceDynamic;
+class UPrimitiveComponent;
+class USceneComponent;
 class UWidget;
 class UCoreTweenWorldSubsystem;
+class FCoreTweenTimeline;
+class FCoreTweenTimelinePlayer;
 
 /**
  * Static factory and management API for CoreTween.
- * Create() returns a builder by value; Run() on the builder launches
- * the coroutine and returns a TTask<void>.
+ * Create() returns a builder by value; Run() on the builder hands the
+ * tween to the per-world subsystem and returns a TTask<void>.
  *
  * Tween state is stored per-world via UCoreTweenWorldSubsystem so that
  * PIE with multiple worlds keeps tweens isolated.
@@ -60,38 +70,206 @@ public:
 	 */
 	static FCoreTweenBuilder Create(UWidget* Widget, float Duration = 1.0f, float Delay = 0.0f, bool bAdditive = false);
 
-	/** Cancel all active tweens on this widget. Derives world from Widget. */
-	static int32 Clear(UWidget* Widget);
+	/**
+	 * Like Create(), but targets the widget's SWidget directly through FSlateWidgetTweenTarget.
+	 * For high-frequency HUD effects; render transform and color bypass the UWidget's properties.
+	 */
+	static FCoreTweenBuilder CreateSlate(UWidget* Widget, float Duration = 1.0f, float Delay = 0.0f, bool bAdditive = false);
+
+	/**
+	 * Create one tween that animates every widget in Widgets, each starting
+	 * StaggerDelay after the previous one in Order. The builder's properties,
+	 * easing and callbacks apply to the whole group: OnStart fires when the first
+	 * widget starts and OnComplete when the last one finishes. Costs one tween
+	 * state and one batch lane regardless of the widget count (see FStaggerTweenTarget).
+	 *
+	 * The group is not indexed under its widgets: GetIsTweening() and Clear() on a
+	 * widget do not see it. Stop it through its handle or task.
+	 *
+	 * @param Duration   Animation duration of each widget in seconds.
+	 * @param bAdditive  If false (default), existing tweens on every widget are cancelled first.
+	 */
+	static FCoreTweenBuilder CreateStaggered(TArrayView<UWidget* const> Widgets, float Duration = 1.0f, float StaggerDelay = 0.05f,
+		ECoreTweenStaggerOrder Order = ECoreTweenStaggerOrder::FirstToLast, float Delay = 0.0f, bool bAdditive = false);
+
+	/**
+	 * Create a tween builder targeting an actor's root component. World location,
+	 * orientation and 3D scale are written in one SetWorldTransform() without sweep.
+	 * @param Teleport  Physics teleport behavior for every transform write.
+	 */
+	static FCoreTweenBuilder CreateForActor(AActor* Actor, float Duration = 1.0f, float Delay = 0.0f, bool bAdditive = false, ETeleportType Teleport = ETeleportType::None);
+
+	/** Like CreateForActor(), but targets any scene component. */
+	static FCoreTweenBuilder CreateForComponent(USceneComponent* Component, float Duration = 1.0f, float Delay = 0.0f, bool bAdditive = false, ETeleportType Teleport = ETeleportType::None);
+
+	/**
+	 * Create a tween builder targeting one parameter of a dynamic material instance.
+	 * Animate it with From/ToMaterialScalar() or From/ToMaterialVector().
+	 * Tweens are keyed by the material, so pass bAdditive = true to animate
+	 * several of its parameters at once.
+	 */
+	static FCoreTweenBuilder CreateForMaterial(UMaterialInstanceDynamic* Material, FName Parameter, float Duration = 1.0f, float Delay = 0.0f, bool bAdditive = false);
+
+	/** Like CreateForMaterial(), but targets the image's brush material, creating its dynamic instance if needed. */
+	static FCoreTweenBuilder CreateForImageMaterial(UImage* Image, FName Parameter, float Duration = 1.0f, float Delay = 0.0f, bool bAdditive = false);
+
+	/** Like CreateForMaterial(), but targets the component's material at ElementIndex, creating its dynamic instance if needed. */
+	static FCoreTweenBuilder CreateForMeshMaterial(UPrimitiveComponent* Component, int32 ElementIndex, FName Parameter, float Duration = 1.0f, float Delay = 0.0f, bool bAdditive = false);
+
+	/**
+	 * Bind a compiled timeline to a widget. Existing tweens on the widget are cancelled
+	 * and the widget is left at the timeline's start. Call Play() or Seek() on the result.
+	 */
+	static TSharedRef<FCoreTweenTimelinePlayer> BindTimeline(UWidget* Widget, const TSharedRef<const FCoreTweenTimeline>& Timeline);
+
+	/** Like BindTimeline(), but targets an actor's root component. */
+	static TSharedRef<FCoreTweenTimelinePlayer> BindTimelineToActor(AActor* Actor, const TSharedRef<const FCoreTweenTimeline>& Timeline, ETeleportType Teleport = ETeleportType::None);
+
+	/** Cancel all active tweens on this widget, actor or component. Derives world from Object. */
+	static int32 Clear(UObject* Object);
 
-	/** @return true if any tween is actively running on this widget. Derives world from Widget. */
-	static bool GetIsTweening(UWidget* Widget);
+	/** @return true if any tween is actively running on this widget, actor or component. Derives world from Object. */
+	static bool GetIsTweening(UObject* Object);
 
 	/** Force-complete all active tweens in the given world context. */
 	static void CompleteAll(UObject* WorldContext);
 
-	/** Internal — called by FCoreTweenBuilder::Run() to register shared state. */
-	static void RegisterTweenState(UObject* WorldContext, TSharedPtr<FCoreTweenState> State);
+	/** Pause a single tween. Its elapsed time is frozen until Resume(). */
+	static bool Pause(UObject* WorldContext, FCoreTweenHandle Handle);
+
+	/** Resume a tween paused with Pause(). */
+	static bool Resume(UObject* WorldContext, FCoreTweenHandle Handle);
+
+	/** Force-complete a single tween. It jumps to its end state and fires OnComplete. */
+	static bool Complete(UObject* WorldContext, FCoreTweenHandle Handle);
+
+	/** Cancel a single tween without firing OnComplete. */
+	static bool Cancel(UObject* WorldContext, FCoreTweenHandle Handle);
+
+	/** @return true if Handle still refers to a running tween. */
+	static bool IsActive(UObject* WorldContext, FCoreTweenHandle Handle);
+
+	/**
+	 * Await a tween launched with Start(). Resolves after the batched tick that
+	 * completes or cancels it, or at once if the handle is stale. Unlike Run(),
+	 * cancelling the tween does not cancel the awaiting flow.
+	 * A tween takes one waiter: a tween launched with Run() resolves at once.
+	 */
+	static AsyncFlow::TTask<void> WaitForCompletion(UObject* WorldContext, FCoreTweenHandle Handle);
+
+	/**
+	 * Move one property of a running tween to a new target without restarting it.
+	 * The tween continues from its current value and velocity; nothing is allocated.
+	 * Call every frame for values that follow something (cursor, health bar, camera
+	 * target) — with FCoreTweenBuilder::Follow() for spring smoothing.
+	 *
+	 * Usage:
+	 *   UCoreTween::Retarget<ECoreTweenProperty::Translation>(this, Handle, FVector2D(X, Y));
+	 *
+	 * @param NewTarget    Value in the property's storage type (FVector4 for Padding).
+	 * @param NewDuration  Duration of the restarted lap; negative keeps the current one.
+	 * @return false if the handle is stale or the tween does not animate Prop.
+	 */
+	template <ECoreTweenProperty Prop, typename T>
+	static bool Retarget(UObject* WorldContext, const FCoreTweenHandle Handle, const T& NewTarget, const float NewDuration = -1.0f)
+	{
+		return RetargetState(WorldContext, Handle, Prop, NewDuration, [&NewTarget](FCoreTweenState& State)
+		{
+			CoreTweenApply::TPropertyAccess<Prop>::Get(State).SetTarget(NewTarget);
+		});
+	}
+
+	/** Set the tween LOD settings of WorldContext's world. Per-tween overrides use FCoreTweenBuilder::SetLODPolicy(). */
+	static void SetLODSettings(UObject* WorldContext, const FCoreTweenLODSettings& Settings);
+
+	/** Set the apply budget of WorldContext's world. Tweens opt into deferral with FCoreTweenBuilder::SetPriority(). */
+	static void SetBudgetSettings(UObject* WorldContext, const FCoreTweenBudgetSettings& Settings);
+
+	/** Set the tick rate of WorldContext's ECoreTweenTimeSource::FixedStep clock. Defaults to CoreTween.FixedStepRate. */
+	static void SetFixedStepRate(UObject* WorldContext, int32 Hz);
 
-	/** Accessor for the active tween states array in the given world context. */
-	static TArray<TSharedPtr<FCoreTweenState>>* GetActiveTweenStates(UObject* WorldContext);
+	/** Run NumSteps fixed steps at once, e.g. to scrub a replay forward. See UCoreTweenWorldSubsystem::FastForwardFixedStep(). */
+	static void FastForwardFixedStep(UObject* WorldContext, int32 NumSteps);
+
+	/**
+	 * Internal — called by FCoreTweenBuilder to hand shared state to the per-world subsystem.
+	 * @return The tween's handle, or an invalid handle if WorldContext has no world.
+	 */
+	static FCoreTweenHandle RegisterTweenState(UObject* WorldContext, TSharedPtr<FCoreTweenState> State);
+
+	/**
+	 * Internal — called by FCoreTweenTimelinePlayer::Play() to have the per-world subsystem tick it.
+	 * @return false if WorldContext has no world.
+	 */
+	static bool RegisterTimelinePlayer(UObject* WorldContext, const TSharedRef<FCoreTweenTimelinePlayer>& Player);
+
+	/**
+	 * Internal — called by FCoreTweenSequence to start steps from inside the tween pass.
+	 * Runs Launch once the pass has flushed its write buffers, so the tweens it starts read
+	 * the values the pass just wrote. Runs it at once outside the pass or without a world.
+	 */
+	static void LaunchAfterFlush(UObject* WorldContext, TFunction<void()> Launch);
+
+	/**
+	 * Internal — called by FCoreTweenBuilder for a recycled state from the per-world pool.
+	 * @return A reset state; freshly allocated if WorldContext has no world.
+	 */
+	static TSharedPtr<FCoreTweenState> AcquireTweenState(UObject* WorldContext);
 
 private:
+	/** Non-template half of Retarget(). */
+	static bool RetargetState(UObject* WorldContext, FCoreTweenHandle Handle, ECoreTweenProperty Prop, float NewDuration, TFunctionRef<void(FCoreTweenState&)> SetTarget);
+
 	/** Resolve the per-world subsystem from any UObject with a world. */
 	static UCoreTweenWorldSubsystem* GetSubsystem(UObject* WorldContext);
 };
 
+/**
+ * Compile-time property set entry point. The applier is instantiated for
+ * exactly TProps, so per-frame cost is one lerp and one target call per
+ * listed property.
+ *
+ * Usage:
+ *   co_await TCoreTween<ECoreTweenProperty::Opacity>::Create(Widget, 0.2f)
+ *       .ToOpacity(1.0f)
+ *       .Run(this);
+ */
+template <ECoreTweenProperty... TProps>
+struct TCoreTween
+{
+	static constexpr ECoreTweenProperty Mask = (ECoreTweenProperty::None | ... | TProps);
+
+	static FCoreTweenBuilder Create(UWidget* Widget, const float Duration = 1.0f, const float Delay = 0.0f, const bool bAdditive = false)
+	{
+		FCoreTweenBuilder Builder = UCoreTween::Create(Widget, Duration, Delay, bAdditive);
+		Builder.WithStaticApplier(Mask, &CoreTweenApply::ApplyMasked<Mask>);
+		return Builder;
+	}
+};
+
 // ============================================================================
-// Blueprint param chain — mirrors UBUIParamChain
+// Blueprint param chain
 // ============================================================================
 
-UCLASS(BlueprintType)
-class CORETWEEN_API UCoreTweenParamChain : public UObject
+/**
+ * Blueprint tween configuration, passed by value through the pure chain nodes.
+ * A plain struct on the Blueprint frame, so building a tween allocates no UObject
+ * and leaves nothing for GC. Copies only bump the target's refcount: Blueprint
+ * callbacks are kept as dynamic delegates and bound to the builder in RunTween.
+ */
+USTRUCT(BlueprintType)
+struct CORETWEEN_API FCoreTweenParams
 {
 	GENERATED_BODY()
 
-public:
-	/** Internally holds the builder state. Consumed by RunTween. */
+	/** Builder state. Copied out and started by RunTween. */
 	FCoreTweenBuilder Builder;
+
+	UPROPERTY()
+	FCoreTweenBPSignature OnStart;
+
+	UPROPERTY()
+	FCoreTweenBPSignature OnComplete;
 };
 
 // ============================================================================
@@ -105,87 +283,95 @@ class CORETWEEN_API UCoreTweenBlueprintFunctionLibrary : public UBlueprintFuncti
 
 public:
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* CreateTween(UWidget* Widget, float Duration = 1.0f, float Delay = 0.0f, bool bAdditive = false);
+	static FCoreTweenParams CreateTween(UWidget* Widget, float Duration = 1.0f, float Delay = 0.0f, bool bAdditive = false);
+
+	/** Like CreateTween(), but one tween animates every widget, each starting StaggerDelay after the previous one in Order. */
+	UFUNCTION(BlueprintPure, Category = "CoreTween")
+	static FCoreTweenParams CreateStaggeredTween(const TArray<UWidget*>& Widgets, float Duration = 1.0f, float StaggerDelay = 0.05f,
+		ECoreTweenStaggerOrder Order = ECoreTweenStaggerOrder::FirstToLast, float Delay = 0.0f, bool bAdditive = false);
 
 	UFUNCTION(BlueprintCallable, Category = "CoreTween", meta = (WorldContext = "WorldContext"))
-	static void RunTween(UCoreTweenParamChain* Params, UObject* WorldContext);
+	static FCoreTweenHandle RunTween(const FCoreTweenParams& Params, UObject* WorldContext);
 
 	// ── Property setters ────────────────────────────────────────────
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* ToTranslation(UCoreTweenParamChain* Chain, FVector2D Target);
+	static FCoreTweenParams ToTranslation(const FCoreTweenParams& Params, FVector2D Target);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* FromTranslation(UCoreTweenParamChain* Chain, FVector2D Start);
+	static FCoreTweenParams FromTranslation(const FCoreTweenParams& Params, FVector2D Start);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* ToScale(UCoreTweenParamChain* Chain, FVector2D Target);
+	static FCoreTweenParams ToScale(const FCoreTweenParams& Params, FVector2D Target);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* FromScale(UCoreTweenParamChain* Chain, FVector2D Start);
+	static FCoreTweenParams FromScale(const FCoreTweenParams& Params, FVector2D Start);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* ToOpacity(UCoreTweenParamChain* Chain, float Target);
+	static FCoreTweenParams ToOpacity(const FCoreTweenParams& Params, float Target);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* FromOpacity(UCoreTweenParamChain* Chain, float Start);
+	static FCoreTweenParams FromOpacity(const FCoreTweenParams& Params, float Start);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* ToColor(UCoreTweenParamChain* Chain, FLinearColor Target);
+	static FCoreTweenParams ToColor(const FCoreTweenParams& Params, FLinearColor Target);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* FromColor(UCoreTweenParamChain* Chain, FLinearColor Start);
+	static FCoreTweenParams FromColor(const FCoreTweenParams& Params, FLinearColor Start);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* ToRotation(UCoreTweenParamChain* Chain, float Target);
+	static FCoreTweenParams ToRotation(const FCoreTweenParams& Params, float Target);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* FromRotation(UCoreTweenParamChain* Chain, float Start);
+	static FCoreTweenParams FromRotation(const FCoreTweenParams& Params, float Start);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* ToCanvasPosition(UCoreTweenParamChain* Chain, FVector2D Target);
+	static FCoreTweenParams ToCanvasPosition(const FCoreTweenParams& Params, FVector2D Target);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* FromCanvasPosition(UCoreTweenParamChain* Chain, FVector2D Start);
+	static FCoreTweenParams FromCanvasPosition(const FCoreTweenParams& Params, FVector2D Start);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* ToPadding(UCoreTweenParamChain* Chain, FMargin Target);
+	static FCoreTweenParams ToPadding(const FCoreTweenParams& Params, FMargin Target);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* FromPadding(UCoreTweenParamChain* Chain, FMargin Start);
+	static FCoreTweenParams FromPadding(const FCoreTweenParams& Params, FMargin Start);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* ToVisibility(UCoreTweenParamChain* Chain, ESlateVisibility Target);
+	static FCoreTweenParams ToVisibility(const FCoreTweenParams& Params, ESlateVisibility Target);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* FromVisibility(UCoreTweenParamChain* Chain, ESlateVisibility Start);
+	static FCoreTweenParams FromVisibility(const FCoreTweenParams& Params, ESlateVisibility Start);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* ToMaxDesiredHeight(UCoreTweenParamChain* Chain, float Target);
+	static FCoreTweenParams ToMaxDesiredHeight(const FCoreTweenParams& Params, float Target);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* FromMaxDesiredHeight(UCoreTweenParamChain* Chain, float Start);
+	static FCoreTweenParams FromMaxDesiredHeight(const FCoreTweenParams& Params, float Start);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* SetEasing(UCoreTweenParamChain* Chain, ECoreTweenEasingType Easing, float EasingParam = 0.0f);
+	static FCoreTweenParams SetEasing(const FCoreTweenParams& Params, ECoreTweenEasingType Easing, float EasingParam = 0.0f);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* SetLoops(UCoreTweenParamChain* Chain, int32 LoopCount);
+	static FCoreTweenParams SetLoops(const FCoreTweenParams& Params, int32 LoopCount);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* SetPingPong(UCoreTweenParamChain* Chain, bool bPingPong);
+	static FCoreTweenParams SetPingPong(const FCoreTweenParams& Params, bool bPingPong);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* SetTimeSource(UCoreTweenParamChain* Chain, ECoreTweenTimeSource TimeSource);
+	static FCoreTweenParams SetTimeSource(const FCoreTweenParams& Params, ECoreTweenTimeSource TimeSource);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* ToReset(UCoreTweenParamChain* Chain);
+	static FCoreTweenParams SetPriority(const FCoreTweenParams& Params, ECoreTweenPriority Priority);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* OnStart(UCoreTweenParamChain* Chain, const FCoreTweenBPSignature& Callback);
+	static FCoreTweenParams ToReset(const FCoreTweenParams& Params);
 
 	UFUNCTION(BlueprintPure, Category = "CoreTween")
-	static UCoreTweenParamChain* OnComplete(UCoreTweenParamChain* Chain, const FCoreTweenBPSignature& Callback);
+	static FCoreTweenParams OnStart(const FCoreTweenParams& Params, const FCoreTweenBPSignature& Callback);
+
+	UFUNCTION(BlueprintPure, Category = "CoreTween")
+	static FCoreTweenParams OnComplete(const FCoreTweenParams& Params, const FCoreTweenBPSignature& Callback);
 
 	// ── Management nodes ────────────────────────────────────────────
 
@@ -194,5 +380,17 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "CoreTween")
 	static bool IsTweening(UWidget* Widget);
+
+	UFUNCTION(BlueprintCallable, Category = "CoreTween", meta = (WorldContext = "WorldContext"))
+	static bool PauseTween(FCoreTweenHandle Handle, UObject* WorldContext);
+
+	UFUNCTION(BlueprintCallable, Category = "CoreTween", meta = (WorldContext = "WorldContext"))
+	static bool ResumeTween(FCoreTweenHandle Handle, UObject* WorldContext);
+
+	UFUNCTION(BlueprintCallable, Category = "CoreTween", meta = (WorldContext = "WorldContext"))
+	static bool CancelTween(FCoreTweenHandle Handle, UObject* WorldContext);
+
+	UFUNCTION(BlueprintPure, Category = "CoreTween", meta = (WorldContext = "WorldContext"))
+	static bool IsTweenActive(FCoreTweenHandle Handle, UObject* WorldContext);
 };
 
@@ -0,0 +1,226 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "CoreTweenBuilder.h"
+#include "CoreTweenTypes.h"
+
+/**
+ * Property appliers. Applying a property is split into two phases:
+ *  - Evaluate: lerp the property at the eased alpha and flag it in
+ *    FCoreTweenState::DirtyMask if it changed. Touches only the state, so it
+ *    may run on a worker thread.
+ *  - Write: push every dirty property to the target and clear the mask.
+ *    Game thread only.
+ *
+ * ApplyMasked<Mask> strings together only the steps in Mask, so a tween that
+ * animates just opacity costs one lerp and one target call per frame with no
+ * IsSet() checks. SelectApplier() picks a pre-instantiated applier for single
+ * properties and the common transition combinations, and falls back to
+ * ApplyDynamic(), which walks the set bits of the state's mask.
+ */
+namespace CoreTweenApply
+{
+	/** Maps a property bit to its TCoreTweenProp in FCoreTweenState::Properties. */
+	template <ECoreTweenProperty Prop>
+	struct TPropertyAccess
+	{
+		static FORCEINLINE typename TCoreTweenPropertyType<Prop>::Type& Get(FCoreTweenState& State) { return State.Properties.Get<Prop>(); }
+	};
+
+	/**
+	 * Lerp one property (or step its follow spring) and flag it dirty if it changed.
+	 * Color and opacity are written every frame.
+	 */
+	template <ECoreTweenProperty Prop>
+	FORCEINLINE void EvaluateProperty(FCoreTweenState& State, const float EasedAlpha)
+	{
+		constexpr bool bAlwaysWrite = Prop == ECoreTweenProperty::Color || Prop == ECoreTweenProperty::Opacity;
+		auto& Property = TPropertyAccess<Prop>::Get(State);
+		const bool bChanged = State.bFollow
+			? Property.Follow(State.FollowDelta, State.FollowOmega)
+			: Property.Update(EasedAlpha, State.VelocityWeight);
+		if (bChanged || bAlwaysWrite)
+		{
+			State.DirtyMask |= Prop;
+		}
+	}
+
+	/** Write one property that is not part of a transform group. */
+	template <ECoreTweenProperty Prop>
+	FORCEINLINE void WriteProperty(FCoreTweenState& State);
+
+	template <>
+	FORCEINLINE void WriteProperty<ECoreTweenProperty::Color>(FCoreTweenState& State)
+	{
+		State.Target->ApplyColor(State.Properties.Get<ECoreTweenProperty::Color>().CurrentValue);
+	}
+
+	template <>
+	FORCEINLINE void WriteProperty<ECoreTweenProperty::Opacity>(FCoreTweenState& State)
+	{
+		State.Target->ApplyOpacity(State.Properties.Get<ECoreTweenProperty::Opacity>().CurrentValue);
+	}
+
+	template <>
+	FORCEINLINE void WriteProperty<ECoreTweenProperty::Visibility>(FCoreTweenState& State)
+	{
+		State.Target->ApplyVisibility(State.Properties.Get<ECoreTweenProperty::Visibility>().CurrentValue);
+	}
+
+	template <>
+	FORCEINLINE void WriteProperty<ECoreTweenProperty::CanvasPosition>(FCoreTweenState& State)
+	{
+		State.Target->ApplyCanvasPosition(State.Properties.Get<ECoreTweenProperty::CanvasPosition>().CurrentValue);
+	}
+
+	template <>
+	FORCEINLINE void WriteProperty<ECoreTweenProperty::Padding>(FCoreTweenState& State)
+	{
+		State.Target->ApplyPadding(State.Properties.Get<ECoreTweenProperty::Padding>().CurrentValue);
+	}
+
+	template <>
+	FORCEINLINE void WriteProperty<ECoreTweenProperty::MaxDesiredHeight>(FCoreTweenState& State)
+	{
+		State.Target->ApplyMaxDesiredHeight(State.Properties.Get<ECoreTweenProperty::MaxDesiredHeight>().CurrentValue);
+	}
+
+	template <>
+	FORCEINLINE void WriteProperty<ECoreTweenProperty::RelativeTransform>(FCoreTweenState& State)
+	{
+		State.Target->ApplyRelativeTransform(State.Properties.Get<ECoreTweenProperty::RelativeTransform>().CurrentValue);
+	}
+
+	template <>
+	FORCEINLINE void WriteProperty<ECoreTweenProperty::MaterialScalar>(FCoreTweenState& State)
+	{
+		State.Target->ApplyMaterialScalar(State.Properties.Get<ECoreTweenProperty::MaterialScalar>().CurrentValue);
+	}
+
+	template <>
+	FORCEINLINE void WriteProperty<ECoreTweenProperty::MaterialVector>(FCoreTweenState& State)
+	{
+		State.Target->ApplyMaterialVector(State.Properties.Get<ECoreTweenProperty::MaterialVector>().CurrentValue);
+	}
+
+	/** The properties that make up a widget's render transform. Written together through ApplyRenderTransform(). */
+	inline constexpr ECoreTweenProperty RenderTransformProperties =
+		ECoreTweenProperty::Translation | ECoreTweenProperty::Scale | ECoreTweenProperty::Rotation;
+
+	/** Hand the dirty render transform properties in Mask to the target in one ApplyRenderTransform() call. */
+	template <ECoreTweenProperty Mask>
+	FORCEINLINE void WriteRenderTransform(FCoreTweenState& State)
+	{
+		FCoreTweenRenderTransform Transform;
+		Transform.Components = State.DirtyMask & Mask;
+		if (Transform.Components == ECoreTweenProperty::None)
+		{
+			return;
+		}
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Translation)) { Transform.Translation = State.Properties.Get<ECoreTweenProperty::Translation>().CurrentValue; }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Scale)) { Transform.Scale = State.Properties.Get<ECoreTweenProperty::Scale>().CurrentValue; }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Rotation)) { Transform.Angle = State.Properties.Get<ECoreTweenProperty::Rotation>().CurrentValue; }
+		State.Target->ApplyRenderTransform(Transform);
+	}
+
+	/** The world-space properties written together through ApplyWorldTransform(). */
+	inline constexpr ECoreTweenProperty WorldTransformProperties =
+		ECoreTweenProperty::Location | ECoreTweenProperty::Orientation | ECoreTweenProperty::Scale3D;
+
+	/** Hand the dirty world transform properties in Mask to the target in one ApplyWorldTransform() call. */
+	template <ECoreTweenProperty Mask>
+	FORCEINLINE void WriteWorldTransform(FCoreTweenState& State)
+	{
+		FCoreTweenWorldTransform Transform;
+		Transform.Components = State.DirtyMask & Mask;
+		if (Transform.Components == ECoreTweenProperty::None)
+		{
+			return;
+		}
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Location)) { Transform.Location = State.Properties.Get<ECoreTweenProperty::Location>().CurrentValue; }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Orientation)) { Transform.Rotation = State.Properties.Get<ECoreTweenProperty::Orientation>().CurrentValue; }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Scale3D)) { Transform.Scale3D = State.Properties.Get<ECoreTweenProperty::Scale3D>().CurrentValue; }
+		State.Target->ApplyWorldTransform(Transform);
+	}
+
+	/** Evaluate exactly the properties in Mask. */
+	template <ECoreTweenProperty Mask>
+	FORCEINLINE void EvaluateMasked(FCoreTweenState& State, const float EasedAlpha)
+	{
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Color)) { EvaluateProperty<ECoreTweenProperty::Color>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Opacity)) { EvaluateProperty<ECoreTweenProperty::Opacity>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Visibility)) { EvaluateProperty<ECoreTweenProperty::Visibility>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Translation)) { EvaluateProperty<ECoreTweenProperty::Translation>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Scale)) { EvaluateProperty<ECoreTweenProperty::Scale>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Rotation)) { EvaluateProperty<ECoreTweenProperty::Rotation>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::CanvasPosition)) { EvaluateProperty<ECoreTweenProperty::CanvasPosition>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Padding)) { EvaluateProperty<ECoreTweenProperty::Padding>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::MaxDesiredHeight)) { EvaluateProperty<ECoreTweenProperty::MaxDesiredHeight>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Location)) { EvaluateProperty<ECoreTweenProperty::Location>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Orientation)) { EvaluateProperty<ECoreTweenProperty::Orientation>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Scale3D)) { EvaluateProperty<ECoreTweenProperty::Scale3D>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::RelativeTransform)) { EvaluateProperty<ECoreTweenProperty::RelativeTransform>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::MaterialScalar)) { EvaluateProperty<ECoreTweenProperty::MaterialScalar>(State, EasedAlpha); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::MaterialVector)) { EvaluateProperty<ECoreTweenProperty::MaterialVector>(State, EasedAlpha); }
+	}
+
+	/** Write the dirty properties in Mask, in bit order, and clear the dirty mask. Transform groups are each one write. */
+	template <ECoreTweenProperty Mask>
+	FORCEINLINE void WriteMasked(FCoreTweenState& State)
+	{
+		const ECoreTweenProperty Dirty = State.DirtyMask;
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Color)) { if (EnumHasAnyFlags(Dirty, ECoreTweenProperty::Color)) { WriteProperty<ECoreTweenProperty::Color>(State); } }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Opacity)) { if (EnumHasAnyFlags(Dirty, ECoreTweenProperty::Opacity)) { WriteProperty<ECoreTweenProperty::Opacity>(State); } }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Visibility)) { if (EnumHasAnyFlags(Dirty, ECoreTweenProperty::Visibility)) { WriteProperty<ECoreTweenProperty::Visibility>(State); } }
+		if constexpr (EnumHasAnyFlags(Mask, RenderTransformProperties)) { WriteRenderTransform<Mask & RenderTransformProperties>(State); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::CanvasPosition)) { if (EnumHasAnyFlags(Dirty, ECoreTweenProperty::CanvasPosition)) { WriteProperty<ECoreTweenProperty::CanvasPosition>(State); } }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::Padding)) { if (EnumHasAnyFlags(Dirty, ECoreTweenProperty::Padding)) { WriteProperty<ECoreTweenProperty::Padding>(State); } }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::MaxDesiredHeight)) { if (EnumHasAnyFlags(Dirty, ECoreTweenProperty::MaxDesiredHeight)) { WriteProperty<ECoreTweenProperty::MaxDesiredHeight>(State); } }
+		if constexpr (EnumHasAnyFlags(Mask, WorldTransformProperties)) { WriteWorldTransform<Mask & WorldTransformProperties>(State); }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::RelativeTransform)) { if (EnumHasAnyFlags(Dirty, ECoreTweenProperty::RelativeTransform)) { WriteProperty<ECoreTweenProperty::RelativeTransform>(State); } }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::MaterialScalar)) { if (EnumHasAnyFlags(Dirty, ECoreTweenProperty::MaterialScalar)) { WriteProperty<ECoreTweenProperty::MaterialScalar>(State); } }
+		if constexpr (EnumHasAnyFlags(Mask, ECoreTweenProperty::MaterialVector)) { if (EnumHasAnyFlags(Dirty, ECoreTweenProperty::MaterialVector)) { WriteProperty<ECoreTweenProperty::MaterialVector>(State); } }
+		State.DirtyMask = ECoreTweenProperty::None;
+	}
+
+	/** Applier compiled for exactly the properties in Mask. Runs the phases selected by Phase. */
+	template <ECoreTweenProperty Mask>
+	void ApplyMasked(FCoreTweenState& State, const float EasedAlpha, const ECoreTweenApplyPhase Phase)
+	{
+		if (EnumHasAnyFlags(Phase, ECoreTweenApplyPhase::Evaluate))
+		{
+			EvaluateMasked<Mask>(State, EasedAlpha);
+		}
+		if (EnumHasAnyFlags(Phase, ECoreTweenApplyPhase::Write))
+		{
+			WriteMasked<Mask>(State);
+		}
+	}
+
+	/** Fallback for masks without a pre-instantiated applier: visits only the set bits of State.PropertyMask. */
+	CORETWEEN_API void ApplyDynamic(FCoreTweenState& State, float EasedAlpha, ECoreTweenApplyPhase Phase);
+
+	/** @return The specialized applier for Mask if one is instantiated, otherwise ApplyDynamic. */
+	CORETWEEN_API FCoreTweenApplyFunc SelectApplier(ECoreTweenProperty Mask);
+} // namespace CoreTweenApply
@@ -0,0 +1,86 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "CoreTweenEasing.h"
+#include "CoreTweenEasingLUT.h"
+#include "CoreTweenTypes.h"
+#include "Containers/Array.h"
+
+struct FCoreTweenState;
+
+/**
+ * Structure-of-arrays storage for the per-frame hot data of every tween that
+ * shares one time source and one easing curve. Evaluate() advances elapsed
+ * time, normalizes it and eases it four lanes at a time; the per-tween work
+ * that cannot be vectorized (bookkeeping, property lerp, callbacks, writes)
+ * then reads the results back by lane through FCoreTweenState::Advance()
+ * and Commit().
+ *
+ * Lanes are unordered. RemoveAtSwap() keeps the arrays dense and patches the
+ * moved state's BatchLane.
+ */
+struct CORETWEEN_API FCoreTweenBatch
+{
+	ECoreTweenTimeSource TimeSource = ECoreTweenTimeSource::Unpaused;
+	ECoreTweenEasingType EasingType = ECoreTweenEasingType::Linear;
+
+	/** Owning state per lane. Lifetime is guaranteed by the subsystem's slot map. */
+	TArray<FCoreTweenState*> States;
+
+	/** Seconds into the current lap, clamped to [0, Duration]. */
+	TArray<float> Elapsed;
+
+	TArray<float> Duration;
+
+	/** Seconds of elapsed time per second of source time. 0 while delayed or paused, -1 on a ping-pong return leg. */
+	TArray<float> Rate;
+
+	/** Easing parameter per lane, already resolved to the curve default when unset. */
+	TArray<float> Param;
+
+	/** Baked curve per lane for ECoreTweenEasingType::Curve; null otherwise. Kept alive by the lane's state. */
+	TArray<const FCoreTweenEasingLUT*> Curve;
+
+	/** Output of Evaluate(): eased progress per lane. */
+	TArray<float> Alpha;
+
+	int32 Num() const { return States.Num(); }
+
+	/** Append a lane for State at Elapsed = 0 and set State->BatchLane. */
+	int32 Add(FCoreTweenState* State);
+
+	/** Remove a lane by swapping the last one into it. */
+	void RemoveAtSwap(int32 Lane);
+
+	/** Advance Elapsed by DeltaTime * Rate, then fill Alpha with the eased normalized progress. */
+	void Evaluate(float DeltaTime) { Evaluate(DeltaTime, 0, Num()); }
+
+	/** Evaluate() over lanes [StartLane, StartLane + NumLanes). Disjoint ranges may be evaluated concurrently. */
+	void Evaluate(float DeltaTime, int32 StartLane, int32 NumLanes);
+
+	void Empty();
+
+	/** Heap bytes held by the lane arrays. */
+	SIZE_T GetAllocatedSize() const;
+};
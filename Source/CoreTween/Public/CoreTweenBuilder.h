@@ -23,46 +23,243 @@
 #pragma once
 
 #include "CoreTweenEasing.h"
-#include "CoreTweenProperty.h"
+#include "CoreTweenEasingLUT.h"
+#include "CoreTweenPropertyStore.h"
 #include "CoreTweenTypes.h"
 #include "Targets/CoreTweenTarget.h"
 #include "AsyncFlowTask.h"
 #include "Math/Vector2D.h"
 #include "Math/Vector4.h"
 #include "Math/Color.h"
+#include "Math/Quat.h"
+#include "Math/Transform.h"
 #include "Layout/Margin.h"
 #include "Components/SlateWrapperTypes.h"
 #include "Templates/SharedPointer.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 
 #include <atomic>
+#include <coroutine>
 
+class UCurveFloat;
 class UWidget;
 class UObject;
+struct FCoreTweenState;
+
+/** Halves of applying a tween's properties. See CoreTweenApply.h. */
+enum class ECoreTweenApplyPhase : uint8
+{
+	/** Lerp properties into the state and flag the changed ones. Worker-thread safe. */
+	Evaluate = 1 << 0,
+
+	/** Write flagged properties to the target. Game thread only. */
+	Write = 1 << 1,
+
+	All = Evaluate | Write
+};
+ENUM_CLASS_FLAGS(ECoreTweenApplyPhase);
+
+/** Events raised by FCoreTweenState::Advance() for Commit() to act on. */
+enum class ECoreTweenStepEvents : uint8
+{
+	None = 0,
+
+	/** The delay ran out this frame — fire OnStart. */
+	Started = 1 << 0,
+
+	/** Properties were evaluated and have to be written. */
+	Evaluated = 1 << 1,
+
+	/** The last lap finished — fire OnComplete. */
+	Completed = 1 << 2,
+
+	/** CompleteAll() was requested — jump to the end. */
+	ForceComplete = 1 << 3
+};
+ENUM_CLASS_FLAGS(ECoreTweenStepEvents);
+
+/** Evaluates and/or writes a tween's animated properties at an eased alpha. See CoreTweenApply.h. */
+using FCoreTweenApplyFunc = void (*)(FCoreTweenState& State, float EasedAlpha, ECoreTweenApplyPhase Phase);
 
 /**
- * Shared mutable state for a running tween. Created by Run() and shared
- * between the coroutine frame and the external tracking system (UCoreTween).
+ * Shared mutable state for a running tween. Created by Run()/Start() and owned
+ * by UCoreTweenWorldSubsystem, which advances every registered state from its
+ * batched tick. The coroutine returned by Run() only waits for completion.
  *
  * The TTask returned by Run() is exclusively owned by the caller.
- * Cancellation and force-complete route through this shared state.
+ * Cancellation, pausing and force-complete route through Handle.
  */
 struct CORETWEEN_API FCoreTweenState
 {
-	/** Set by CompleteAll(). The coroutine loop checks this each tick. */
+	/** Set by CompleteAll(). The subsystem checks this each tick. */
 	std::atomic<bool> bForceComplete{false};
 
-	/** The flow state of the TTask running this tween. Used for cancellation. */
-	TSharedPtr<AsyncFlow::FAsyncFlowState> FlowState;
+	/**
+	 * The flow state of the TTask running this tween. Used for cancellation.
+	 * Not owned — cleared by the completion awaiter when the coroutine frame goes away.
+	 */
+	AsyncFlow::FAsyncFlowState* FlowState = nullptr;
 
-	/** The widget being tweened. Used by GetIsTweening()/Clear(). */
-	TWeakObjectPtr<UWidget> Widget;
+	/** The object being tweened (widget, actor or component). Keys GetIsTweening()/Clear(). */
+	TWeakObjectPtr<UObject> TargetObject;
 
-	/** True once the coroutine has finished (naturally, cancelled, or force-completed). */
+	/** True once the tween has finished (naturally, cancelled, or force-completed). */
 	std::atomic<bool> bFinished{false};
 
-	/** Keeps the coroutine alive until completion. Cleared when finished. */
-	AsyncFlow::TTask<void> RunningTask;
+	/** Slot handle assigned by the subsystem on registration. */
+	FCoreTweenHandle Handle;
+
+	/** While true the subsystem skips this tween; time does not accumulate. */
+	bool bPaused = false;
+
+	/** Coroutine suspended on this tween's completion. Resumed by the subsystem after the batch. */
+	std::coroutine_handle<> Waiter;
+
+	// ── Runtime data (moved in from the builder by Run()) ───────────
+
+	TSharedPtr<ICoreTweenTarget> Target;
+
+	/** Target came from the subsystem's FWidgetTweenTarget pool and goes back there on release. */
+	bool bPooledTarget = false;
+
+	/** Elapsed time and playback rate live in the owning FCoreTweenBatch lane, not here. */
+	float Duration = 1.0f;
+	float DelayRemaining = 0.0f;
+
+	ECoreTweenEasingType EasingType = ECoreTweenEasingType::Linear;
+	TOptional<float> EasingParam;
+
+	/** Baked curve for ECoreTweenEasingType::Curve. */
+	TSharedPtr<const FCoreTweenEasingLUT> EasingCurve;
+
+	int32 LoopsRemaining = 1;
+	bool bPingPong = false;
+	bool bForward = true;
+	bool bStarted = false;
+	ECoreTweenTimeSource TimeSource = ECoreTweenTimeSource::Unpaused;
+
+	/** Lane index inside the subsystem's batch for (TimeSource, EasingType). INDEX_NONE until batched. */
+	int32 BatchLane = INDEX_NONE;
+
+	/** Per-tween LOD override. Default uses the world's FCoreTweenLODSettings. */
+	ECoreTweenLODPolicy LODPolicy = ECoreTweenLODPolicy::Default;
+
+	/** Per-tween throttle interval in frames. 0 uses the world's. */
+	int32 LODThrottleInterval = 0;
+
+	/** Result of the last relevance check. Written in the apply phase, read in the next evaluate phase. */
+	bool bRelevant = true;
+
+	/** Apply budget class. Cosmetic writes can be deferred. */
+	ECoreTweenPriority Priority = ECoreTweenPriority::Normal;
+
+	/** Consecutive frames this tween's write was deferred by the apply budget. */
+	uint8 DeferredFrames = 0;
+
+	/** A deferred write is owed: the next Commit() writes even if nothing was evaluated since. */
+	bool bWritePending = false;
+
+	/** Follow mode: properties chase their targets with a critically damped spring and the tween never completes. */
+	bool bFollow = false;
+
+	/** Spring frequency for follow mode, 2 / smooth time. */
+	float FollowOmega = 0.0f;
+
+	/** Source time accumulated since the last follow step (frames skipped by tween LOD add up). */
+	float FollowDelta = 0.0f;
+
+	/** Set by a retarget: the lap started with the properties' carried Velocity, which fades out over the lap. */
+	bool bCarryVelocity = false;
+
+	/** Weight of each property's carried Velocity at the current alpha. Written by Advance(). */
+	float VelocityWeight = 0.0f;
+
+	/** Animated properties. Only the ones that were set take space. */
+	FCoreTweenPropertyStore Properties;
+
+	FCoreTweenSignature OnStartDelegate;
+	FCoreTweenSignature OnCompleteDelegate;
+
+	/** Properties this tween animates, captured at launch. */
+	ECoreTweenProperty PropertyMask = ECoreTweenProperty::None;
+
+	/** Applier specialized for PropertyMask, selected at launch. */
+	FCoreTweenApplyFunc Applier = nullptr;
+
+	/** Properties evaluated since the last write whose value changed. */
+	ECoreTweenProperty DirtyMask = ECoreTweenProperty::None;
+
+	/** Output of the last Advance(), consumed by Commit(). */
+	ECoreTweenStepEvents StepEvents = ECoreTweenStepEvents::None;
+
+	/** @return Mask of every property with a start or target set. */
+	ECoreTweenProperty ComputePropertyMask() const { return Properties.GetMask(); }
+
+	/** Read "from current" defaults off the target, apply alpha 0, and fire OnStart if there is no delay. */
+	void Begin();
+
+	/** Fill every unset start (and target) value of the animated properties from the target's current values. */
+	void ReadFromCurrent();
+
+	/** Make the next evaluate flag every animated property dirty, even if its value has not changed. */
+	void InvalidateCurrent();
+
+	/**
+	 * Restart the lap from the current values of every animated property,
+	 * folding the current velocity into each property's carried Velocity.
+	 * Called by UCoreTweenWorldSubsystem::Retarget() before the new targets are set.
+	 * @param EaseSlope      Rate of change of the eased alpha per second at the current elapsed time.
+	 * @param VelocityDecay  Rate of change of the previously carried velocity's weight.
+	 */
+	void Rebase(float EaseSlope, float VelocityDecay);
+
+	/**
+	 * Evaluate half of a per-lane step, run after the batch has evaluated elapsed
+	 * time and easing: delay countdown, property lerp and lap/loop bookkeeping.
+	 * Touches only this state and its lane, so lanes can be advanced in parallel.
+	 * The result is stored in StepEvents.
+	 *
+	 * @param DeltaTime  Delta of this tween's time source.
+	 * @param EasedAlpha Eased progress computed by the batch for this lane.
+	 * @param Elapsed    The lane's elapsed time. Rewound here when a loop restarts.
+	 * @param Rate       The lane's playback rate. Updated on start, ping-pong flips and loops.
+	 * @param bEvaluate  False when tween LOD skips this frame. Timing and callbacks still advance,
+	 *                   and the final frame is always evaluated.
+	 */
+	void Advance(float DeltaTime, float EasedAlpha, float& Elapsed, float& Rate, bool bEvaluate = true);
+
+	/**
+	 * Re-evaluate the animated properties at PresentElapsed seconds into the lap
+	 * without touching timing: sub-step interpolation for FixedStep tweens, run
+	 * after Advance() on the frame's last step. The next Commit() writes the result.
+	 * Does nothing for follow tweens, tweens still delayed, and tweens ending this step.
+	 */
+	void Present(float PresentElapsed);
+
+	/**
+	 * Apply half of a per-lane step. Game thread only: writes the evaluated
+	 * properties to the target and fires the callbacks raised by Advance().
+	 * @param bDeferWrite  Hold the property write back for a later Commit() (apply budget).
+	 *                     Callbacks still fire, and the last frame is always written.
+	 * @return true once the tween has reached its end (or its target died).
+	 */
+	bool Commit(bool bDeferWrite = false);
+
+	/** Playback rate for the batch lane: 0 while delayed or paused, -1 on a ping-pong return leg, 1 otherwise. */
+	float GetLaneRate() const;
+
+	/** Ease a normalized alpha with this tween's curve, including baked ECoreTweenEasingType::Curve curves. */
+	float Ease(float Alpha) const;
+
+	/** Evaluate and write all animated properties at the given eased alpha through the selected applier. Game thread only. */
+	void ApplyAll(float EasedAlpha);
+
+	/** Return every field to its default so the subsystem can hand this state out again. */
+	void Reset();
+
+private:
+	/** End-of-lap bookkeeping: ping-pong flip, loop countdown and rewind. @return Completed on the last lap. */
+	ECoreTweenStepEvents FinishLap(float& Elapsed, float& Rate);
 };
 
 /**
@@ -74,7 +271,7 @@ class CORETWEEN_API FCoreTweenBuilder
 {
 public:
 	FCoreTweenBuilder() = default;
-	FCoreTweenBuilder(TSharedPtr<ICoreTweenTarget> InTarget, UWidget* InWidget, float InDuration, float InDelay, bool bInAdditive);
+	FCoreTweenBuilder(TSharedPtr<ICoreTweenTarget> InTarget, UObject* InTargetObject, float InDuration, float InDelay, bool bInAdditive, bool bInPooledTarget = false);
 
 	// ── Property setters ────────────────────────────────────────────
 
@@ -97,33 +294,116 @@ public:
 	FCoreTweenBuilder& FromMaxDesiredHeight(float Value);
 	FCoreTweenBuilder& ToMaxDesiredHeight(float Value);
 
+	// World-space properties — for actor and scene component targets.
+	FCoreTweenBuilder& FromLocation(const FVector& Value);
+	FCoreTweenBuilder& ToLocation(const FVector& Value);
+	FCoreTweenBuilder& FromOrientation(const FQuat& Value);
+	FCoreTweenBuilder& ToOrientation(const FQuat& Value);
+	FCoreTweenBuilder& FromScale3D(const FVector& Value);
+	FCoreTweenBuilder& ToScale3D(const FVector& Value);
+	FCoreTweenBuilder& FromRelativeTransform(const FTransform& Value);
+	FCoreTweenBuilder& ToRelativeTransform(const FTransform& Value);
+
+	// Material parameters — for material targets. The parameter name is fixed by the target.
+	FCoreTweenBuilder& FromMaterialScalar(float Value);
+	FCoreTweenBuilder& ToMaterialScalar(float Value);
+	FCoreTweenBuilder& FromMaterialVector(const FLinearColor& Value);
+	FCoreTweenBuilder& ToMaterialVector(const FLinearColor& Value);
+
 	// ── Configuration ───────────────────────────────────────────────
 
 	FCoreTweenBuilder& Easing(ECoreTweenEasingType InType, TOptional<float> InParam = {});
+
+	/** Ease with a designer curve, baked once into a table (see FCoreTweenEasingLUT::FromCurve()). */
+	FCoreTweenBuilder& EasingCurve(const UCurveFloat* Curve);
+
+	/** Ease with an already baked table. Share one table across many tweens. */
+	FCoreTweenBuilder& EasingCurve(const TSharedPtr<const FCoreTweenEasingLUT>& Curve);
+
+	/** Ease with a CSS-style cubic bezier, baked once into a table. */
+	FCoreTweenBuilder& EasingBezier(float X1, float Y1, float X2, float Y2);
 	FCoreTweenBuilder& ToReset();
 	FCoreTweenBuilder& SetDelay(float Seconds);
 	FCoreTweenBuilder& SetLoops(int32 Count);
 	FCoreTweenBuilder& SetPingPong(bool bInPingPong);
 	FCoreTweenBuilder& SetTimeSource(ECoreTweenTimeSource Source);
 
+	/**
+	 * Override the world's tween LOD policy for this tween. See FCoreTweenLODSettings.
+	 * @param ThrottleInterval  Frames between writes under Throttle. 0 uses the world's interval.
+	 */
+	FCoreTweenBuilder& SetLODPolicy(ECoreTweenLODPolicy Policy, int32 ThrottleInterval = 0);
+
+	/** Apply budget class. Default Normal. See FCoreTweenBudgetSettings. */
+	FCoreTweenBuilder& SetPriority(ECoreTweenPriority InPriority);
+
+	/**
+	 * Follow mode: instead of easing over Duration, every property chases its
+	 * target with a critically damped spring, so targets can be moved every frame
+	 * with UCoreTween::Retarget() without restarting anything. The tween runs until
+	 * cancelled or completed; completing snaps to the targets.
+	 * @param SmoothTime  Roughly the time to close most of the distance to the target.
+	 */
+	FCoreTweenBuilder& Follow(float SmoothTime);
+
 	// ── Callbacks ───────────────────────────────────────────────────
 
 	FCoreTweenBuilder& OnStart(const FCoreTweenSignature& InDelegate);
 	FCoreTweenBuilder& OnComplete(const FCoreTweenSignature& InDelegate);
 
+	/**
+	 * Pin the applier to one compiled for a fixed property set. Used by TCoreTween.
+	 * If the properties actually set differ from StaticMask, the runtime-selected applier is used.
+	 */
+	FCoreTweenBuilder& WithStaticApplier(ECoreTweenProperty StaticMask, FCoreTweenApplyFunc InApplier);
+
+	// ── Queries ─────────────────────────────────────────────────────
+
+	float GetDelay() const { return Delay; }
+
+	/** Delay plus every lap (ping-pong counts both legs). Infinite loops count as one lap. */
+	float GetTotalDuration() const;
+
+	/**
+	 * Copy this builder's configuration, properties and callbacks into State
+	 * without consuming the builder. The target is not copied. Used by
+	 * FCoreTweenTimeline, whose compiled tracks are bound to many targets.
+	 */
+	void InitTrackState(FCoreTweenState& State) const;
+
 	// ── Terminal — returns the awaitable task ────────────────────────
 
+	/**
+	 * Hand the tween to the per-world subsystem and return a task that
+	 * resolves when the subsystem's batched tick finishes it.
+	 */
 	AsyncFlow::TTask<void> Run(UObject* WorldContext);
 
+	/**
+	 * Fire-and-forget launch. Hands the tween to the per-world subsystem
+	 * without creating a coroutine.
+	 * @return Handle for Pause/Resume/Cancel, or an invalid handle if WorldContext has no world.
+	 */
+	FCoreTweenHandle Start(UObject* WorldContext);
+
+	/**
+	 * Move all builder state, target and callbacks included, into a reset State.
+	 * Does not register it anywhere. Used by Run()/Start() and by FCoreTweenSimulation.
+	 */
+	void MoveInto(FCoreTweenState& State);
+
 private:
-	/** Apply all set properties at the given eased alpha. */
-	void ApplyAll(float EasedAlpha);
+	/** Move all builder state into a tween state taken from WorldContext's pool. */
+	TSharedPtr<FCoreTweenState> MakeState(UObject* WorldContext);
 
-	/** Read current values from target for properties without explicit start. */
-	void BeginAllProperties();
+	/** Copy everything but the target and callbacks into State, then select its applier. */
+	void CopyConfigTo(FCoreTweenState& TweenState) const;
 
 	TSharedPtr<ICoreTweenTarget> Target;
-	TWeakObjectPtr<UWidget> WidgetPtr;
+
+	/** Target came from the subsystem's FWidgetTweenTarget pool and goes back there on release. */
+	bool bPooledTarget = false;
+	TWeakObjectPtr<UObject> TargetObject;
 
 	float Duration = 1.0f;
 	float Delay = 0.0f;
@@ -131,22 +411,23 @@ private:
 
 	ECoreTweenEasingType EasingType = ECoreTweenEasingType::Linear;
 	TOptional<float> EasingParam;
+	TSharedPtr<const FCoreTweenEasingLUT> EasingCurveTable;
 
 	int32 LoopCount = 1;
 	bool bPingPong = false;
 	ECoreTweenTimeSource TimeSource = ECoreTweenTimeSource::Unpaused;
+	ECoreTweenLODPolicy LODPolicy = ECoreTweenLODPolicy::Default;
+	int32 LODThrottleInterval = 0;
+	ECoreTweenPriority Priority = ECoreTweenPriority::Normal;
+	bool bFollow = false;
+	float FollowSmoothTime = 0.0f;
 
-	TCoreTweenProp<FVector2D> TranslationProp;
-	TCoreTweenProp<FVector2D> ScaleProp;
-	TCoreTweenProp<FLinearColor> ColorProp;
-	TCoreTweenProp<float> OpacityProp;
-	TCoreTweenProp<float> RotationProp;
-	TCoreTweenProp<FVector2D> CanvasPositionProp;
-	TCoreTweenProp<FVector4> PaddingProp;
-	TCoreTweenInstantProp<ESlateVisibility> VisibilityProp;
-	TCoreTweenProp<float> MaxDesiredHeightProp;
+	FCoreTweenPropertyStore Properties;
 
 	FCoreTweenSignature OnStartDelegate;
 	FCoreTweenSignature OnCompleteDelegate;
+
+	ECoreTweenProperty StaticPropertyMask = ECoreTweenProperty::None;
+	FCoreTweenApplyFunc StaticApplier = nullptr;
 };
 
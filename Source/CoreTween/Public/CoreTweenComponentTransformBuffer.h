@@ -0,0 +1,84 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "CoreTweenTypes.h"
+#include "CoreTweenWriteBuffer.h"
+#include "Engine/EngineTypes.h"
+#include "Math/Transform.h"
+#include "Misc/Optional.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class USceneComponent;
+struct FCoreTweenWorldTransform;
+
+/** A scene component's merged transform writes, pending until the next flush. */
+struct FCoreTweenPendingComponentTransform
+{
+	TWeakObjectPtr<USceneComponent> Component;
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector Scale3D = FVector::OneVector;
+	ECoreTweenProperty WorldComponents = ECoreTweenProperty::None;
+	TOptional<FTransform> Relative;
+	ETeleportType Teleport = ETeleportType::None;
+	int32 AttachDepth = 0;
+};
+
+/**
+ * Collects scene component transform writes so each component moved by one
+ * or more tweens in a batch is written once. Location, rotation and scale are
+ * merged into a single SetWorldTransform() (no sweep) instead of one
+ * SetWorldLocation/Rotation/Scale each, and components are flushed parents
+ * first so a moved child is never re-propagated by a later write to its parent.
+ * Each flush triggers at most one UpdateComponentToWorld cascade per component.
+ */
+class CORETWEEN_API FCoreTweenComponentTransformBuffer
+	: public TCoreTweenWriteBuffer<FCoreTweenComponentTransformBuffer, USceneComponent, FCoreTweenPendingComponentTransform>
+{
+public:
+	/** Merge the flagged world components of Value into Component's pending write. */
+	void MergeWorld(USceneComponent* Component, const FCoreTweenWorldTransform& Value, ETeleportType Teleport);
+
+	/** Replace Component's pending relative transform. Applied before any pending world components. */
+	void MergeRelative(USceneComponent* Component, const FTransform& Value, ETeleportType Teleport);
+
+	/**
+	 * Component's world and relative transforms as the next flush will leave them.
+	 * @return false if nothing was merged for Component since the last flush.
+	 */
+	bool Find(const USceneComponent* Component, FTransform& OutWorld, FTransform& OutRelative) const;
+
+	/** Write each pending transform, parents before children, and reset for the next batch. */
+	void Flush();
+
+	/** Write a single world transform change immediately. Shared by the targets' unbuffered path. */
+	static void WriteWorld(USceneComponent* Component, const FCoreTweenWorldTransform& Value, ETeleportType Teleport);
+
+private:
+	friend TCoreTweenWriteBuffer;
+
+	FCoreTweenPendingComponentTransform& FindOrAdd(USceneComponent* Component, ETeleportType Teleport);
+
+	static FCoreTweenComponentTransformBuffer* Active;
+};
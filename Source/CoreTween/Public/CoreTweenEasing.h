@@ -29,6 +29,8 @@
 
 #include "CoreTweenEasing.generated.h"
 
+class FCoreTweenEasingLUT;
+
 UENUM(BlueprintType)
 enum class ECoreTweenEasingType : uint8
 {
@@ -74,7 +76,10 @@ enum class ECoreTweenEasingType : uint8
 	EaseOutBounce,
 	EaseInOutBounce,
 
-	Spring
+	Spring,
+
+	/** Designer curve baked into an FCoreTweenEasingLUT. See FCoreTweenBuilder::EasingCurve(). Linear without one. */
+	Curve
 };
 
 /**
@@ -83,6 +88,12 @@ enum class ECoreTweenEasingType : uint8
  */
 struct CORETWEEN_API FCoreTweenEasing
 {
+	/** Number of ECoreTweenEasingType values. Used to size per-easing storage. */
+	static constexpr int32 NumEasingTypes = static_cast<int32>(ECoreTweenEasingType::Curve) + 1;
+
+	/** Default parameter for Back (overshoot), Elastic (amplitude) and Spring (damping); 0 for the rest. */
+	static float GetDefaultParam(ECoreTweenEasingType Type);
+
 	/**
 	 * Dispatch to the appropriate easing function.
 	 *
@@ -93,6 +104,40 @@ struct CORETWEEN_API FCoreTweenEasing
 	 */
 	static float Ease(ECoreTweenEasingType Type, float Alpha, TOptional<float> Param = {});
 
+	/** Ease() through the analytic functions only, ignoring LUT mode. */
+	static float EaseAnalytic(ECoreTweenEasingType Type, float Alpha, TOptional<float> Param = {});
+
+	/**
+	 * Ease a contiguous run of alphas in place with a single curve.
+	 * The polynomial families (Linear, Quad, Cubic, Quart, Quint) run four lanes
+	 * at a time on VectorRegister4Float; the rest use a tight per-curve loop
+	 * with no per-element dispatch.
+	 *
+	 * @param Type        Easing curve shared by every lane.
+	 * @param InOutAlpha  Normalized progress per lane, overwritten with the eased value.
+	 * @param Params      Per-lane parameter (see Ease()). Ignored by curves without one.
+	 * @param Num         Lane count.
+	 */
+	static void EaseBatch(ECoreTweenEasingType Type, float* InOutAlpha, const float* Params, int32 Num);
+
+	/** EaseBatch() for ECoreTweenEasingType::Curve: each lane samples its own baked curve. Null curves stay linear. */
+	static void EaseCurveBatch(const FCoreTweenEasingLUT* const* Curves, float* InOutAlpha, int32 Num);
+
+	// ── LUT mode ────────────────────────────────────────────────────
+
+	/**
+	 * Opt-in lookup tables for the transcendental curves (Expo, Sine, Elastic, Spring).
+	 * Tables are baked for the default parameter at Resolution segments and sampled
+	 * with linear interpolation; lanes with a custom parameter stay analytic.
+	 * 0 disables LUT mode (the default). Also set by CoreTween.EasingLUTResolution.
+	 * Call on the game thread.
+	 */
+	static void SetLUTResolution(int32 Resolution);
+	static int32 GetLUTResolution();
+
+	/** @return The baked table for Type, or nullptr if LUT mode is off or Type is not tabulated. */
+	static const FCoreTweenEasingLUT* GetLUT(ECoreTweenEasingType Type);
+
 	// ── Individual easing functions ──────────────────────────────────
 
 	static float Linear(float Alpha);
@@ -0,0 +1,76 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Math/UnrealMathUtility.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+
+class UCurveFloat;
+
+/**
+ * An easing curve baked into a uniform table over alpha [0, 1] and sampled
+ * with linear interpolation. Used by LUT mode for the built-in transcendental
+ * curves, and by ECoreTweenEasingType::Curve for designer curves, which are
+ * evaluated once per sample at bake time instead of once per tween per frame.
+ * Immutable once baked; share it across tweens through TSharedRef.
+ */
+class CORETWEEN_API FCoreTweenEasingLUT
+{
+public:
+	static constexpr int32 DefaultResolution = 256;
+
+	/** Bake Func at Resolution + 1 evenly spaced alphas. */
+	static TSharedRef<const FCoreTweenEasingLUT> Bake(TFunctionRef<float(float)> Func, int32 Resolution = DefaultResolution);
+
+	/**
+	 * Bake a UCurveFloat. The curve's key time range maps to alpha [0, 1] and its
+	 * values are used as the eased alpha. Bakes are cached per curve and resolution
+	 * outside the editor, where curves can still change.
+	 * @return A linear table if Curve is null.
+	 */
+	static TSharedRef<const FCoreTweenEasingLUT> FromCurve(const UCurveFloat* Curve, int32 Resolution = DefaultResolution);
+
+	/** Bake a CSS-style cubic bezier through (0,0), (X1,Y1), (X2,Y2), (1,1). X1 and X2 are clamped to [0, 1]. */
+	static TSharedRef<const FCoreTweenEasingLUT> FromCubicBezier(float X1, float Y1, float X2, float Y2, int32 Resolution = DefaultResolution);
+
+	/** Eased alpha at Alpha (clamped to [0, 1]). */
+	FORCEINLINE float Sample(const float Alpha) const
+	{
+		const float X = FMath::Clamp(Alpha, 0.0f, 1.0f) * Scale;
+		const int32 Index = FMath::Min(static_cast<int32>(X), Resolution - 1);
+		const float* Pair = Samples.GetData() + Index;
+		return Pair[0] + (Pair[1] - Pair[0]) * (X - static_cast<float>(Index));
+	}
+
+	int32 GetResolution() const { return Resolution; }
+
+	/** @return Approximate memory used by the table. */
+	SIZE_T GetAllocatedSize() const { return Samples.GetAllocatedSize(); }
+
+private:
+	TArray<float> Samples;
+	float Scale = 1.0f;
+	int32 Resolution = 1;
+};
@@ -0,0 +1,91 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "CoreTweenWriteBuffer.h"
+#include "Math/Color.h"
+#include "UObject/NameTypes.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UMaterialInstanceDynamic;
+
+/** One parameter's pending value. */
+template <typename ValueType>
+struct TCoreTweenPendingMaterialParameter
+{
+	int32 ParameterIndex = INDEX_NONE;
+	FName ParameterName;
+	ValueType Value;
+};
+
+/** A material instance's pending parameter writes. */
+struct FCoreTweenPendingMaterialParameters
+{
+	TWeakObjectPtr<UMaterialInstanceDynamic> Material;
+	TArray<TCoreTweenPendingMaterialParameter<float>, TInlineAllocator<4>> Scalars;
+	TArray<TCoreTweenPendingMaterialParameter<FLinearColor>, TInlineAllocator<2>> Vectors;
+};
+
+/**
+ * Collects material parameter writes so each dynamic material instance driven
+ * by one or more tweens in a batch is updated once, in one place. Writes to
+ * the same parameter are merged (the last one wins), so each parameter of a
+ * MID pushes at most one render-thread update per flush however many tweens
+ * touched it, and a MID's parameters are written back to back.
+ *
+ * Writes address parameters by the index FMaterialTweenTarget cached when the
+ * tween started; the name is kept only as a fallback for an index that no
+ * longer resolves.
+ */
+class CORETWEEN_API FCoreTweenMaterialParameterBuffer
+	: public TCoreTweenWriteBuffer<FCoreTweenMaterialParameterBuffer, UMaterialInstanceDynamic, FCoreTweenPendingMaterialParameters>
+{
+public:
+	/** Replace Material's pending value for the scalar parameter at ParameterIndex. */
+	void MergeScalar(UMaterialInstanceDynamic* Material, int32 ParameterIndex, FName ParameterName, float Value);
+
+	/** Replace Material's pending value for the vector parameter at ParameterIndex. */
+	void MergeVector(UMaterialInstanceDynamic* Material, int32 ParameterIndex, FName ParameterName, const FLinearColor& Value);
+
+	/** @return Material's pending value for the named scalar parameter, or nullptr if none was merged since the last flush. */
+	const float* FindScalar(const UMaterialInstanceDynamic* Material, FName ParameterName) const;
+
+	/** @return Material's pending value for the named vector parameter, or nullptr if none was merged since the last flush. */
+	const FLinearColor* FindVector(const UMaterialInstanceDynamic* Material, FName ParameterName) const;
+
+	/** Write each material's pending parameters and reset for the next batch. */
+	void Flush();
+
+	/** Write one scalar parameter immediately. Shared by the target's unbuffered path. */
+	static void WriteScalar(UMaterialInstanceDynamic* Material, int32 ParameterIndex, FName ParameterName, float Value);
+
+	/** Write one vector parameter immediately. Shared by the target's unbuffered path. */
+	static void WriteVector(UMaterialInstanceDynamic* Material, int32 ParameterIndex, FName ParameterName, const FLinearColor& Value);
+
+private:
+	friend TCoreTweenWriteBuffer;
+
+	FCoreTweenPendingMaterialParameters& FindOrAdd(UMaterialInstanceDynamic* Material);
+
+	static FCoreTweenMaterialParameterBuffer* Active;
+};
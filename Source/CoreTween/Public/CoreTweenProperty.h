@@ -22,14 +22,95 @@
 
 #pragma once
 
+#include "Math/Color.h"
+#include "Math/Quat.h"
+#include "Math/Transform.h"
 #include "Math/UnrealMathUtility.h"
+#include "Math/Vector4.h"
+#include "Math/VectorRegister.h"
+
+#include <type_traits>
+
+namespace CoreTweenMath
+{
+	/** Generic interpolation — defers to FMath::Lerp. */
+	template <typename T>
+	FORCEINLINE T Lerp(const T& A, const T& B, const float Alpha)
+	{
+		return FMath::Lerp<T>(A, B, Alpha);
+	}
+
+	/** All four channels in one register: A + (B - A) * Alpha. */
+	FORCEINLINE FLinearColor Lerp(const FLinearColor& A, const FLinearColor& B, const float Alpha)
+	{
+		const VectorRegister4Float VA = VectorLoad(&A.R);
+		const VectorRegister4Float VB = VectorLoad(&B.R);
+		FLinearColor Result;
+		VectorStore(VectorMultiplyAdd(VectorSubtract(VB, VA), VectorSetFloat1(Alpha), VA), &Result.R);
+		return Result;
+	}
+
+	/** Rotations take the shortest arc. */
+	FORCEINLINE FQuat Lerp(const FQuat& A, const FQuat& B, const float Alpha)
+	{
+		return FQuat::Slerp(A, B, Alpha);
+	}
+
+	/** Lerps translation and scale, slerps rotation. */
+	FORCEINLINE FTransform Lerp(const FTransform& A, const FTransform& B, const float Alpha)
+	{
+		FTransform Result;
+		Result.Blend(A, B, Alpha);
+		return Result;
+	}
+
+	template <typename T>
+	FORCEINLINE bool Equals(const T& A, const T& B)
+	{
+		return A == B;
+	}
+
+	/** FTransform has no operator==. */
+	FORCEINLINE bool Equals(const FTransform& A, const FTransform& B)
+	{
+		return A.Equals(B, 0.0);
+	}
+
+	/** Value types with vector-space arithmetic (T + T, T * float). Only these carry a velocity. */
+	template <typename T>
+	struct TIsLinear
+	{
+		static constexpr bool Value = false;
+	};
+
+	template <> struct TIsLinear<float> { static constexpr bool Value = true; };
+	template <> struct TIsLinear<FVector2D> { static constexpr bool Value = true; };
+	template <> struct TIsLinear<FVector> { static constexpr bool Value = true; };
+	template <> struct TIsLinear<FVector4> { static constexpr bool Value = true; };
+	template <> struct TIsLinear<FLinearColor> { static constexpr bool Value = true; };
+
+	/** Stands in for the velocity of types that cannot carry one. */
+	struct FNoVelocity
+	{
+	};
+
+	/** Padding and other FVector4 props, one register wide at the vector's native precision. */
+	FORCEINLINE FVector4 Lerp(const FVector4& A, const FVector4& B, const float Alpha)
+	{
+		const auto VA = VectorLoad(&A.X);
+		const auto VB = VectorLoad(&B.X);
+		FVector4 Result;
+		VectorStore(VectorMultiplyAdd(VectorSubtract(VB, VA), VectorSetFloat1(static_cast<FVector4::FReal>(Alpha)), VA), &Result.X);
+		return Result;
+	}
+} // namespace CoreTweenMath
 
 /**
  * Interpolating property template. Tracks start, target, and current values
  * for a single tweened property. Lerps between Start and Target based on
  * the eased alpha provided each frame.
  *
- * @tparam T  Value type (must support FMath::Lerp — FVector2D, float, FLinearColor, FVector4).
+ * @tparam T  Value type (must support CoreTweenMath::Lerp — FVector2D, float, FLinearColor, FVector4, FVector, FQuat, FTransform).
  */
 template <typename T>
 class TCoreTweenProp
@@ -40,6 +121,12 @@ public:
 	T StartValue{};
 	T TargetValue{};
 	T CurrentValue{};
+
+	/**
+	 * Units per second. The velocity carried into a lap by Rebase(), or the
+	 * spring velocity integrated by Follow(). Only linear types store one.
+	 */
+	std::conditional_t<CoreTweenMath::TIsLinear<T>::Value, T, CoreTweenMath::FNoVelocity> Velocity{};
 	bool bIsFirstTime = true;
 
 	bool IsSet() const
@@ -76,13 +163,65 @@ public:
 
 	/**
 	 * Update the current value based on eased alpha.
+	 * @param VelocityWeight  Scale of the carried Velocity this frame (see FCoreTweenState::VelocityWeight).
 	 * @return true if the value changed (or first frame), false if unchanged.
 	 */
-	bool Update(float EasedAlpha)
+	bool Update(float EasedAlpha, float VelocityWeight = 0.0f)
+	{
+		const T OldValue = CurrentValue;
+		CurrentValue = CoreTweenMath::Lerp(StartValue, TargetValue, EasedAlpha);
+		if constexpr (CoreTweenMath::TIsLinear<T>::Value)
+		{
+			if (VelocityWeight != 0.0f)
+			{
+				CurrentValue = CurrentValue + Velocity * VelocityWeight;
+			}
+		}
+		const bool bShouldUpdate = bIsFirstTime || !CoreTweenMath::Equals(CurrentValue, OldValue);
+		bIsFirstTime = false;
+		return bShouldUpdate;
+	}
+
+	/**
+	 * Start a new lap from the current value, keeping the current velocity.
+	 * @param EaseSlope      Rate of change of the eased alpha per second at this moment.
+	 * @param VelocityDecay  Rate of change of the previously carried velocity's weight.
+	 */
+	void Rebase(float EaseSlope, float VelocityDecay)
+	{
+		if constexpr (CoreTweenMath::TIsLinear<T>::Value)
+		{
+			Velocity = (TargetValue - StartValue) * EaseSlope + Velocity * VelocityDecay;
+		}
+		bHasStart = true;
+		StartValue = CurrentValue;
+	}
+
+	/**
+	 * Advance a critically damped spring toward TargetValue. Stateful: the
+	 * velocity carries over between frames, so the target may move every frame.
+	 * Non-linear types (rotations, transforms) approach exponentially instead.
+	 * @param Omega  Spring frequency, 2 / smooth time.
+	 * @return true if the value changed (or first frame).
+	 */
+	bool Follow(float DeltaTime, float Omega)
 	{
 		const T OldValue = CurrentValue;
-		CurrentValue = FMath::Lerp<T>(StartValue, TargetValue, EasedAlpha);
-		const bool bShouldUpdate = bIsFirstTime || (CurrentValue != OldValue);
+		if constexpr (CoreTweenMath::TIsLinear<T>::Value)
+		{
+			// Closed-form step of x'' = -omega^2 (x - target) - 2 omega x' (Game Programming Gems 4, 1.10); stable for any DeltaTime.
+			const float X = Omega * DeltaTime;
+			const float Decay = 1.0f / (1.0f + X + 0.48f * X * X + 0.235f * X * X * X);
+			const T Offset = CurrentValue - TargetValue;
+			const T Impulse = (Velocity + Offset * Omega) * DeltaTime;
+			Velocity = (Velocity - Impulse * Omega) * Decay;
+			CurrentValue = TargetValue + (Offset + Impulse) * Decay;
+		}
+		else
+		{
+			CurrentValue = CoreTweenMath::Lerp(CurrentValue, TargetValue, 1.0f - FMath::Exp(-Omega * DeltaTime));
+		}
+		const bool bShouldUpdate = bIsFirstTime || !CoreTweenMath::Equals(CurrentValue, OldValue);
 		bIsFirstTime = false;
 		return bShouldUpdate;
 	}
@@ -140,7 +279,7 @@ public:
 	 * Snap to target when alpha >= 1, otherwise hold start.
 	 * @return true if the value changed (or first frame).
 	 */
-	bool Update(float EasedAlpha)
+	bool Update(float EasedAlpha, float /*VelocityWeight*/ = 0.0f)
 	{
 		const T OldValue = CurrentValue;
 		if (EasedAlpha >= 1.0f && bHasTarget)
@@ -155,5 +294,24 @@ public:
 		bIsFirstTime = false;
 		return bShouldChange;
 	}
-};
 
+	/** Start a new lap from the current value. */
+	void Rebase(float /*EaseSlope*/, float /*VelocityDecay*/)
+	{
+		bHasStart = true;
+		StartValue = CurrentValue;
+	}
+
+	/** Discrete values cannot spring: snap to the target. */
+	bool Follow(float /*DeltaTime*/, float /*Omega*/)
+	{
+		const T OldValue = CurrentValue;
+		if (bHasTarget)
+		{
+			CurrentValue = TargetValue;
+		}
+		const bool bShouldChange = bIsFirstTime || (OldValue != CurrentValue);
+		bIsFirstTime = false;
+		return bShouldChange;
+	}
+};
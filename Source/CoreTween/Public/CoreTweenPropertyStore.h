@@ -0,0 +1,204 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "CoreTweenProperty.h"
+#include "CoreTweenTypes.h"
+#include "Components/SlateWrapperTypes.h"
+#include "Containers/Array.h"
+#include "Math/Vector2D.h"
+
+#include <type_traits>
+
+/** Maps a property bit to the TCoreTweenProp it is stored as. */
+template <ECoreTweenProperty Prop>
+struct TCoreTweenPropertyType;
+
+#define CORETWEEN_PROPERTY_TYPE(Name, PropType) \
+	template <> \
+	struct TCoreTweenPropertyType<ECoreTweenProperty::Name> \
+	{ \
+		using Type = PropType; \
+	};
+
+CORETWEEN_PROPERTY_TYPE(Color, TCoreTweenProp<FLinearColor>)
+CORETWEEN_PROPERTY_TYPE(Opacity, TCoreTweenProp<float>)
+CORETWEEN_PROPERTY_TYPE(Visibility, TCoreTweenInstantProp<ESlateVisibility>)
+CORETWEEN_PROPERTY_TYPE(Translation, TCoreTweenProp<FVector2D>)
+CORETWEEN_PROPERTY_TYPE(Scale, TCoreTweenProp<FVector2D>)
+CORETWEEN_PROPERTY_TYPE(Rotation, TCoreTweenProp<float>)
+CORETWEEN_PROPERTY_TYPE(CanvasPosition, TCoreTweenProp<FVector2D>)
+CORETWEEN_PROPERTY_TYPE(Padding, TCoreTweenProp<FVector4>)
+CORETWEEN_PROPERTY_TYPE(MaxDesiredHeight, TCoreTweenProp<float>)
+CORETWEEN_PROPERTY_TYPE(Location, TCoreTweenProp<FVector>)
+CORETWEEN_PROPERTY_TYPE(Orientation, TCoreTweenProp<FQuat>)
+CORETWEEN_PROPERTY_TYPE(Scale3D, TCoreTweenProp<FVector>)
+CORETWEEN_PROPERTY_TYPE(RelativeTransform, TCoreTweenProp<FTransform>)
+CORETWEEN_PROPERTY_TYPE(MaterialScalar, TCoreTweenProp<float>)
+CORETWEEN_PROPERTY_TYPE(MaterialVector, TCoreTweenProp<FLinearColor>)
+
+#undef CORETWEEN_PROPERTY_TYPE
+
+/**
+ * Sparse storage for the properties of a builder or tween state. Only the
+ * properties that were set take space. They are packed in the order they
+ * were first set into a small inline buffer, which spills to the heap only
+ * past InlineBlocks (three or more vector properties, or a relative transform).
+ *
+ * Every property type is plain data, so the store copies and relocates as raw
+ * bytes and Reset() runs no destructors.
+ */
+class FCoreTweenPropertyStore
+{
+	/** Storage unit. 16 bytes covers the alignment of every property type. */
+	struct alignas(16) FBlock
+	{
+		uint8 Bytes[16];
+	};
+
+public:
+	/** Inline capacity: opacity, translation and scale together fit without a heap allocation. */
+	static constexpr int32 InlineBlocks = 12;
+
+	/** What a builder or state spent on properties when it embedded all fifteen of them. */
+	static constexpr SIZE_T DenseSize =
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::Color>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::Opacity>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::Visibility>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::Translation>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::Scale>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::Rotation>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::CanvasPosition>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::Padding>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::MaxDesiredHeight>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::Location>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::Orientation>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::Scale3D>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::RelativeTransform>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::MaterialScalar>::Type) +
+		sizeof(TCoreTweenPropertyType<ECoreTweenProperty::MaterialVector>::Type);
+
+	/** Properties present in the store. */
+	ECoreTweenProperty GetMask() const { return Mask; }
+
+	bool Contains(const ECoreTweenProperty Prop) const { return EnumHasAnyFlags(Mask, Prop); }
+
+	/** Access a property known to be present (it is in the tween's PropertyMask). */
+	template <ECoreTweenProperty Prop>
+	FORCEINLINE typename TCoreTweenPropertyType<Prop>::Type& Get()
+	{
+		checkSlow(Contains(Prop));
+		return *reinterpret_cast<typename TCoreTweenPropertyType<Prop>::Type*>(reinterpret_cast<uint8*>(Storage.GetData()) + Offsets[IndexOf(Prop)] * sizeof(FBlock));
+	}
+
+	template <ECoreTweenProperty Prop>
+	FORCEINLINE const typename TCoreTweenPropertyType<Prop>::Type& Get() const
+	{
+		checkSlow(Contains(Prop));
+		return *reinterpret_cast<const typename TCoreTweenPropertyType<Prop>::Type*>(reinterpret_cast<const uint8*>(Storage.GetData()) + Offsets[IndexOf(Prop)] * sizeof(FBlock));
+	}
+
+	/** @return The property, or nullptr if it was never set. */
+	template <ECoreTweenProperty Prop>
+	FORCEINLINE typename TCoreTweenPropertyType<Prop>::Type* Find()
+	{
+		return Contains(Prop) ? &Get<Prop>() : nullptr;
+	}
+
+	template <ECoreTweenProperty Prop>
+	FORCEINLINE const typename TCoreTweenPropertyType<Prop>::Type* Find() const
+	{
+		return Contains(Prop) ? &Get<Prop>() : nullptr;
+	}
+
+	/** Access a property, appending a default one if it was never set. */
+	template <ECoreTweenProperty Prop>
+	typename TCoreTweenPropertyType<Prop>::Type& FindOrAdd()
+	{
+		using PropType = typename TCoreTweenPropertyType<Prop>::Type;
+		static_assert(alignof(PropType) <= alignof(FBlock), "Property type is over-aligned for the store");
+		static_assert(std::is_trivially_destructible_v<PropType>, "Reset() does not run destructors");
+
+		if (!Contains(Prop))
+		{
+			const int32 FirstBlock = Storage.AddUninitialized((sizeof(PropType) + sizeof(FBlock) - 1) / sizeof(FBlock));
+			Offsets[IndexOf(Prop)] = static_cast<uint8>(FirstBlock);
+			Mask |= Prop;
+			new (Storage.GetData() + FirstBlock) PropType();
+		}
+		return Get<Prop>();
+	}
+
+	/** Call Func on every stored property in bit order. Func must accept any property type. */
+	template <typename FuncType>
+	FORCEINLINE void ForEach(FuncType&& Func)
+	{
+		using EProp = ECoreTweenProperty;
+		Visit<EProp::Color, EProp::Opacity, EProp::Visibility, EProp::Translation, EProp::Scale, EProp::Rotation,
+			EProp::CanvasPosition, EProp::Padding, EProp::MaxDesiredHeight,
+			EProp::Location, EProp::Orientation, EProp::Scale3D, EProp::RelativeTransform,
+			EProp::MaterialScalar, EProp::MaterialVector>(Func);
+	}
+
+	/** Drop every property. Keeps any heap allocation for the next use. */
+	void Reset()
+	{
+		Storage.Reset();
+		Mask = ECoreTweenProperty::None;
+	}
+
+	/** Heap bytes held beyond the inline buffer. */
+	SIZE_T GetAllocatedSize() const
+	{
+		return Storage.Max() > InlineBlocks ? Storage.GetAllocatedSize() : 0;
+	}
+
+private:
+	static constexpr int32 NumProperties = 15;
+
+	/** Bit index of a single-bit property. */
+	static constexpr int32 IndexOf(const ECoreTweenProperty Prop)
+	{
+		uint32 Bits = static_cast<uint32>(Prop);
+		int32 Index = 0;
+		while (Bits > 1)
+		{
+			Bits >>= 1;
+			++Index;
+		}
+		return Index;
+	}
+
+	template <ECoreTweenProperty... Props, typename FuncType>
+	FORCEINLINE void Visit(FuncType& Func)
+	{
+		((Contains(Props) ? (void)Func(Get<Props>()) : (void)0), ...);
+	}
+
+	TArray<FBlock, TInlineAllocator<InlineBlocks>> Storage;
+
+	/** First block of each property, by bit index. Valid only for bits in Mask. */
+	uint8 Offsets[NumProperties] = {};
+
+	ECoreTweenProperty Mask = ECoreTweenProperty::None;
+};
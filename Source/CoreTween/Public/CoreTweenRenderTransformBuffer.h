@@ -0,0 +1,64 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "CoreTweenWriteBuffer.h"
+#include "Slate/WidgetTransform.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UWidget;
+struct FCoreTweenRenderTransform;
+
+/** A widget's render transform as the next flush will write it. */
+struct FCoreTweenPendingRenderTransform
+{
+	TWeakObjectPtr<UWidget> Widget;
+	FWidgetTransform Transform;
+};
+
+/**
+ * Collects widget render transform writes so that every tween touching the
+ * same widget in a batch results in one SetRenderTransform() — one layout and
+ * render transform invalidation — instead of one per tween per component.
+ */
+class CORETWEEN_API FCoreTweenRenderTransformBuffer
+	: public TCoreTweenWriteBuffer<FCoreTweenRenderTransformBuffer, UWidget, FCoreTweenPendingRenderTransform>
+{
+public:
+	/**
+	 * Merge the flagged components of Value into Widget's pending transform.
+	 * The widget's current transform is read once, on its first merge since the last flush.
+	 */
+	void Merge(UWidget* Widget, const FCoreTweenRenderTransform& Value);
+
+	/** @return Widget's pending transform, or nullptr if nothing was merged for it since the last flush. */
+	const FWidgetTransform* Find(const UWidget* Widget) const;
+
+	/** Write each pending transform with a single SetRenderTransform() and reset for the next batch. */
+	void Flush();
+
+private:
+	friend TCoreTweenWriteBuffer;
+
+	static FCoreTweenRenderTransformBuffer* Active;
+};
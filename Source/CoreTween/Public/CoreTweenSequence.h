@@ -23,19 +23,32 @@
 #pragma once
 
 #include "CoreTweenBuilder.h"
+#include "CoreTweenTypes.h"
 #include "AsyncFlowTask.h"
 #include "Containers/Array.h"
 
 class UObject;
+class FCoreTweenTimeline;
 
 /**
- * Sequential tween chain. Build a sequence of FCoreTweenBuilder steps,
- * then Run() to execute them one after another as a single awaitable task.
+ * Tween choreography. Steps are placed on one timeline: Then()/Append() add
+ * a step after everything so far, Join() runs a step alongside the previous
+ * one, and Insert() places a step at an absolute time. Callbacks can be placed
+ * the same way.
+ *
+ * A running sequence is one driver tween in UCoreTweenWorldSubsystem. Each
+ * frame the driver's clock launches the steps and fires the callbacks it has
+ * passed, so a 40-step sequence costs one update per frame and no coroutine
+ * per step. Steps launch as ordinary batched tweens and read their "from
+ * current" values when they start. Step start times are absolute, so late
+ * frames never accumulate drift.
  *
  * Usage:
  *   co_await FCoreTweenSequence::Create()
- *       .Then(UCoreTween::Create(Widget, 0.3f).ToOpacity(1.0f))
- *       .Then(UCoreTween::Create(Widget, 0.2f).ToScale(FVector2D::UnitVector))
+ *       .Then(UCoreTween::Create(Panel, 0.3f).ToOpacity(1.0f))
+ *       .Join(UCoreTween::Create(Panel, 0.3f).FromScale(FVector2D(0.9f)).ToScale(FVector2D::UnitVector))
+ *       .Then(UCoreTween::Create(Title, 0.2f).ToOpacity(1.0f))
+ *       .InsertCallback(0.15f, FCoreTweenSignature::CreateLambda([]() { PlayWhoosh(); }))
  *       .Run(this);
  */
 class CORETWEEN_API FCoreTweenSequence
@@ -44,18 +57,81 @@ public:
 	/** Create an empty sequence. */
 	static FCoreTweenSequence Create();
 
-	/** Append a tween step. Moves the builder into the sequence. */
+	/** Append a tween step after everything added so far. Moves the builder into the sequence. */
 	FCoreTweenSequence& Then(FCoreTweenBuilder InBuilder);
 
+	/** Same as Then(). */
+	FCoreTweenSequence& Append(FCoreTweenBuilder InBuilder);
+
+	/** Start a tween step at the same time as the previously added step. */
+	FCoreTweenSequence& Join(FCoreTweenBuilder InBuilder);
+
+	/** Start a tween step at an absolute time (seconds from the start of the sequence). */
+	FCoreTweenSequence& Insert(float Time, FCoreTweenBuilder InBuilder);
+
+	/** Leave a gap after everything added so far. */
+	FCoreTweenSequence& AppendInterval(float Seconds);
+
+	/** Fire Callback once everything added so far has finished. */
+	FCoreTweenSequence& AppendCallback(FCoreTweenSignature Callback);
+
+	/** Fire Callback at an absolute time. Callbacks fire before steps that start at the same time. */
+	FCoreTweenSequence& InsertCallback(float Time, FCoreTweenSignature Callback);
+
+	/** Clock that drives step start times and callbacks. Steps keep their own time sources. Default: Unpaused. */
+	FCoreTweenSequence& SetTimeSource(ECoreTweenTimeSource Source);
+
+	/** @return Length of the sequence in seconds. Infinite-loop steps count as one lap. */
+	float GetDuration() const { return Duration; }
+
 	/**
-	 * Execute all steps sequentially. Each step runs to completion
-	 * before the next begins.
-	 * @param WorldContext  UObject used by AsyncFlow for world context.
-	 * @return Awaitable task that resolves when the last step completes.
+	 * Start the sequence and return a task that resolves when its clock reaches
+	 * the end. Cancelling the task, or the driver's handle, cancels every step
+	 * it launched. Consumes the sequence.
+	 * @param WorldContext  UObject used to resolve the world.
 	 */
 	AsyncFlow::TTask<void> Run(UObject* WorldContext);
 
+	/**
+	 * Fire-and-forget launch. Consumes the sequence.
+	 * @return Handle to the driver tween: Pause freezes the sequence clock (running steps finish),
+	 *         Cancel cancels every launched step, Complete jumps every step to its end.
+	 */
+	FCoreTweenHandle Start(UObject* WorldContext);
+
+	/**
+	 * Compile the steps and callbacks into a seekable timeline that can be bound to
+	 * any number of targets. Does not consume the sequence. Build its steps with
+	 * FCoreTweenTimeline::Track(); the targets of the step builders are ignored.
+	 */
+	TSharedRef<const FCoreTweenTimeline> Compile() const;
+
 private:
-	TArray<FCoreTweenBuilder> Steps;
-};
+	class FPlayer;
+
+	struct FStep
+	{
+		FCoreTweenBuilder Builder;
+		float StartTime = 0.0f;
+	};
+
+	struct FCallback
+	{
+		FCoreTweenSignature Callback;
+		float Time = 0.0f;
+	};
 
+	/** Move the steps into a player and wrap it in its driver tween. */
+	FCoreTweenBuilder MakeDriver(UObject* WorldContext);
+
+	TArray<FStep> Steps;
+	TArray<FCallback> Callbacks;
+
+	/** End of everything added so far. */
+	float Duration = 0.0f;
+
+	/** Start time of the last added step; where Join() places the next one. */
+	float LastStartTime = 0.0f;
+
+	ECoreTweenTimeSource TimeSource = ECoreTweenTimeSource::Unpaused;
+};
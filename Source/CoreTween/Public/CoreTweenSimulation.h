@@ -0,0 +1,80 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "CoreTweenBatch.h"
+#include "CoreTweenTypes.h"
+#include "Containers/Array.h"
+#include "Templates/SharedPointer.h"
+
+class FCoreTweenBuilder;
+struct FCoreTweenState;
+
+/**
+ * Headless tween runner. Drives tweens through the same batch kernels,
+ * FCoreTweenState::Advance() and FCoreTweenState::Commit() as
+ * UCoreTweenWorldSubsystem, without a world, AsyncFlow, pools or tween LOD.
+ * Every tween is advanced by the delta passed to Tick(), whatever its time source.
+ *
+ * Pair it with FMemoryTweenTarget to run tween math without any UObject,
+ * e.g. from a commandlet (see UCoreTweenBenchmarkCommandlet). Not thread safe.
+ */
+class CORETWEEN_API FCoreTweenSimulation
+{
+public:
+	FCoreTweenSimulation();
+	~FCoreTweenSimulation();
+
+	FCoreTweenSimulation(const FCoreTweenSimulation&) = delete;
+	FCoreTweenSimulation& operator=(const FCoreTweenSimulation&) = delete;
+
+	/**
+	 * Consume Builder and start its tween. Start values are applied and OnStart
+	 * fires (unless delayed) before this returns. The builder must not be used afterwards.
+	 */
+	FCoreTweenHandle Start(FCoreTweenBuilder& Builder);
+
+	/** Evaluate every running tween by DeltaTime, then write targets and fire callbacks. */
+	void Tick(float DeltaTime);
+
+	/** Force-complete a tween: it lands on its end values and fires OnComplete on the next Tick(). @return false if it already finished. */
+	bool Complete(FCoreTweenHandle Handle);
+
+	/** Drop every tween without firing callbacks. Capacity is kept. */
+	void Reset();
+
+	/** Number of tweens still running. */
+	int32 Num() const { return NumRunning; }
+
+	/** Resolve a handle to its state. Finished states stay resolvable until Reset(). */
+	const FCoreTweenState* Find(FCoreTweenHandle Handle) const;
+
+private:
+	/** One batch per easing curve. */
+	TArray<FCoreTweenBatch> Batches;
+
+	/** Every state started since the last Reset(), indexed by handle. */
+	TArray<TSharedPtr<FCoreTweenState>> States;
+
+	int32 NumRunning = 0;
+};
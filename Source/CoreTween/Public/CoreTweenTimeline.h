@@ -0,0 +1,185 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "CoreTweenBuilder.h"
+#include "CoreTweenTypes.h"
+#include "Containers/Array.h"
+#include "Templates/SharedPointer.h"
+
+class UObject;
+
+/**
+ * A compiled, seekable tween timeline. Built once from an FCoreTweenSequence
+ * with Compile() and immutable afterwards, so one timeline can be shared by
+ * any number of FCoreTweenTimelinePlayer bindings (a list of 50 cards can
+ * share a single compiled timeline).
+ *
+ * Tracks are kept sorted by start time with precomputed end times, plus a
+ * running maximum of end times. Both arrays are monotonic, so the tracks
+ * whose span overlaps any time range are found with two binary searches.
+ *
+ * Build tracks with Track() rather than UCoreTween::Create(): compiled
+ * builders are templates, and the target they were created with is ignored.
+ *
+ * Usage:
+ *   const TSharedRef<const FCoreTweenTimeline> CardIntro = FCoreTweenSequence::Create()
+ *       .Then(FCoreTweenTimeline::Track(0.2f).FromOpacity(0.0f).ToOpacity(1.0f))
+ *       .Join(FCoreTweenTimeline::Track(0.3f).FromTranslation(FVector2D(0, 40)).ToTranslation(FVector2D::ZeroVector))
+ *       .Compile();
+ *
+ *   for (UWidget* Card : Cards)
+ *   {
+ *       UCoreTween::BindTimeline(Card, CardIntro)->Play(this);
+ *   }
+ */
+class CORETWEEN_API FCoreTweenTimeline
+{
+public:
+	/** One compiled step. Template holds the step's configuration; it is never consumed. */
+	struct FTrack
+	{
+		FCoreTweenBuilder Template;
+		float StartTime = 0.0f;
+		float EndTime = 0.0f;
+	};
+
+	/** A callback at a fixed time. Fired by forward playback only, never by Seek(). */
+	struct FMarker
+	{
+		FCoreTweenSignature Callback;
+		float Time = 0.0f;
+	};
+
+	FCoreTweenTimeline(TArray<FTrack>&& InTracks, TArray<FMarker>&& InMarkers, float InDuration);
+
+	/** Target-less builder for a timeline track. */
+	static FCoreTweenBuilder Track(float Duration, float Delay = 0.0f);
+
+	float GetDuration() const { return Duration; }
+	int32 Num() const { return Tracks.Num(); }
+	const FTrack& GetTrack(int32 Index) const { return Tracks[Index]; }
+	const TArray<FMarker>& GetMarkers() const { return Markers; }
+
+	/**
+	 * Tracks whose span overlaps [From, To], as the index range [OutFirst, OutLast).
+	 * The range can also contain tracks that finished before From. O(log n).
+	 */
+	void FindOverlapping(float From, float To, int32& OutFirst, int32& OutLast) const;
+
+private:
+	/** Sorted by StartTime. */
+	TArray<FTrack> Tracks;
+
+	/** MaxEndTimes[i] = max(EndTime) of Tracks[0..i]. Non-decreasing, so it can be binary searched. */
+	TArray<float> MaxEndTimes;
+
+	/** Sorted by Time. */
+	TArray<FMarker> Markers;
+
+	float Duration = 0.0f;
+};
+
+/**
+ * Binds a compiled timeline to one target and plays it. Any time can be
+ * reached with Seek(), which only writes the tracks overlapping the span
+ * between the old and new time. Seek() works while playing (scrubbing
+ * continues playback from the new time) and without a world (editor preview).
+ *
+ * "From current" start values are read once when the player is created, as
+ * if every earlier track had finished, so seeking is deterministic. Creating
+ * a player leaves the target at the timeline's start.
+ *
+ * Playing players are ticked by UCoreTweenWorldSubsystem after the tween
+ * batches, so their transform writes are merged with the batched tweens'.
+ * The subsystem keeps a playing player alive until it stops.
+ */
+class CORETWEEN_API FCoreTweenTimelinePlayer : public TSharedFromThis<FCoreTweenTimelinePlayer>
+{
+public:
+	FCoreTweenTimelinePlayer(const TSharedRef<const FCoreTweenTimeline>& InTimeline, const TSharedRef<ICoreTweenTarget>& InTarget);
+
+	/** Start or continue playback from the current time in the current direction. */
+	void Play(UObject* WorldContext);
+
+	/** Stop advancing. The target keeps its current values. */
+	void Pause();
+
+	/** Jump to Time (clamped to the timeline) and write the result immediately. */
+	void Seek(float InTime);
+
+	/** Flip the playback direction. Reverse playback fires no markers or track callbacks. */
+	void Reverse();
+
+	/** Playback speed multiplier. Negative values are clamped to 0; use Reverse() to play backwards. */
+	void SetPlayRate(float InPlayRate);
+
+	/** Clock that advances playback. Default: Unpaused. */
+	void SetTimeSource(ECoreTweenTimeSource Source) { TimeSource = Source; }
+
+	/** Fired when playback reaches the end (or the start, when reversed). */
+	void OnFinished(const FCoreTweenSignature& InDelegate) { OnFinishedDelegate = InDelegate; }
+
+	float GetTime() const { return Time; }
+	float GetPlayRate() const { return PlayRate; }
+	bool IsPlaying() const { return bPlaying; }
+	bool IsReversed() const { return bReversed; }
+	ECoreTweenTimeSource GetTimeSource() const { return TimeSource; }
+	const TSharedRef<const FCoreTweenTimeline>& GetTimeline() const { return Timeline; }
+
+	/**
+	 * Internal — advance playback by DeltaTime. Called by UCoreTweenWorldSubsystem.
+	 * @return false once playback has stopped; the subsystem then drops the player.
+	 */
+	bool Tick(float DeltaTime);
+
+	/** Internal — called by UCoreTweenWorldSubsystem when it drops the player. */
+	void Detach();
+
+private:
+	/** Write every track overlapping [OldTime, NewTime] at NewTime. */
+	void Evaluate(float OldTime, float NewTime);
+
+	/** Fire markers and track callbacks in (OldTime, NewTime]; [OldTime, NewTime] when bInclusive. */
+	void FireEvents(float OldTime, float NewTime, bool bInclusive);
+
+	TSharedRef<const FCoreTweenTimeline> Timeline;
+	TSharedRef<ICoreTweenTarget> Target;
+
+	/** One bound state per track, parallel to the timeline's tracks. */
+	TArray<FCoreTweenState> States;
+
+	FCoreTweenSignature OnFinishedDelegate;
+
+	float Time = 0.0f;
+	float PlayRate = 1.0f;
+	ECoreTweenTimeSource TimeSource = ECoreTweenTimeSource::Unpaused;
+	bool bReversed = false;
+	bool bPlaying = false;
+
+	/** In the subsystem's player list. Stays set until the subsystem drops the player. */
+	bool bRegistered = false;
+
+	/** Next forward tick also fires events at exactly the current time (playback from 0). */
+	bool bFireAtCurrentTime = false;
+};
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include "Misc/EnumClassFlags.h"
+#include "Templates/TypeHash.h"
 #include "UObject/ObjectMacros.h"
 
 #include "CoreTweenTypes.generated.h"
@@ -37,6 +39,171 @@ enum class ECoreTweenTimeSource : uint8
 	/** Unpaused time. Ticks during pause. Default for widget tweens. */
 	Unpaused,
 	/** Wall-clock real time. Ignores pause and time dilation. */
-	RealTime
+	RealTime,
+	/**
+	 * Game time quantized into whole ticks of the world's fixed step rate
+	 * (UCoreTween::SetFixedStepRate()). Tween state depends only on the tick
+	 * count, so replays reproduce it exactly. Pauses with the game.
+	 */
+	FixedStep
 };
 
+/** How a tween is updated while its target is irrelevant (hidden, transparent, off-screen, inactive or far away). */
+UENUM(BlueprintType)
+enum class ECoreTweenLODPolicy : uint8
+{
+	/** Per-tween only: use the world's policy. */
+	Default,
+	/** Update every frame regardless of relevance. */
+	AlwaysUpdate,
+	/** Write irrelevant tweens every ThrottleInterval frames. */
+	Throttle,
+	/** Do not write irrelevant tweens until they become relevant again. */
+	Skip
+};
+
+/** How a tween's target writes compete for the world's apply budget. See FCoreTweenBudgetSettings. */
+UENUM(BlueprintType)
+enum class ECoreTweenPriority : uint8
+{
+	/** Written every frame and never throttled or skipped by tween LOD. */
+	Critical,
+	/** Written every frame. The default. */
+	Normal,
+	/** Written after everything else; deferred to a later frame once the apply budget is spent. */
+	Cosmetic
+};
+
+/** Order in which the widgets of a staggered tween start. See UCoreTween::CreateStaggered(). */
+UENUM(BlueprintType)
+enum class ECoreTweenStaggerOrder : uint8
+{
+	/** First widget first. */
+	FirstToLast,
+	/** Last widget first. */
+	LastToFirst,
+	/** Middle widget(s) first, spreading outward. */
+	FromCenter,
+	/** Both ends first, closing in on the middle. */
+	FromEdges,
+	/** A fresh random permutation per launch. */
+	Random
+};
+
+/**
+ * Tween LOD settings for a world. Time keeps advancing for irrelevant
+ * tweens; only their property evaluation and target writes are throttled,
+ * so they snap to the correct value as soon as they are written again. The
+ * final frame of a tween is always written.
+ */
+USTRUCT(BlueprintType)
+struct CORETWEEN_API FCoreTweenLODSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CoreTween|LOD")
+	ECoreTweenLODPolicy Policy = ECoreTweenLODPolicy::AlwaysUpdate;
+
+	/** Throttle policy: irrelevant tweens are written once every this many frames. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CoreTween|LOD", meta = (ClampMin = "1"))
+	int32 ThrottleInterval = 4;
+
+	/** Frames between relevance checks of each tween. Checks are staggered across tweens. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CoreTween|LOD", meta = (ClampMin = "1"))
+	int32 RelevanceCheckInterval = 8;
+
+	/** Actor and component tweens farther than this from every local player's view point are irrelevant. 0 disables the test. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CoreTween|LOD", meta = (ClampMin = "0", Units = "cm"))
+	float MaxViewDistance = 10000.0f;
+};
+
+/**
+ * Apply budget for a world. Critical and Normal tweens are written every
+ * frame; Cosmetic tweens are written with whatever budget is left, and the
+ * rest wait for a later frame. Deferral only holds back the target write:
+ * time, loops and callbacks advance as usual, and a deferred tween is written
+ * at its current value. The final frame of a tween is always written.
+ * New worlds start from the CoreTween.ApplyBudgetMs and
+ * CoreTween.MaxDeferredFrames cvars.
+ */
+USTRUCT(BlueprintType)
+struct CORETWEEN_API FCoreTweenBudgetSettings
+{
+	GENERATED_BODY()
+
+	/** Game-thread time per frame for the apply phase before Cosmetic writes are deferred. 0 disables the budget. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CoreTween|Budget", meta = (ClampMin = "0", Units = "ms"))
+	float ApplyBudgetMs = 2.0f;
+
+	/** A Cosmetic tween deferred this many frames in a row is written regardless of the budget. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CoreTween|Budget", meta = (ClampMin = "1"))
+	int32 MaxDeferredFrames = 4;
+};
+
+/**
+ * Bit per tweenable property. A tween's set properties are captured as a
+ * mask when it launches, and the mask selects its property applier.
+ * Bit order is apply order.
+ */
+enum class ECoreTweenProperty : uint32
+{
+	None             = 0,
+	Color            = 1 << 0,
+	Opacity          = 1 << 1,
+	Visibility       = 1 << 2,
+	Translation      = 1 << 3,
+	Scale            = 1 << 4,
+	Rotation         = 1 << 5,
+	CanvasPosition   = 1 << 6,
+	Padding          = 1 << 7,
+	MaxDesiredHeight = 1 << 8,
+
+	// World-space properties (actors and scene components)
+	Location          = 1 << 9,
+	Orientation       = 1 << 10,
+	Scale3D           = 1 << 11,
+	RelativeTransform = 1 << 12,
+
+	// Material parameters (UMaterialInstanceDynamic)
+	MaterialScalar    = 1 << 13,
+	MaterialVector    = 1 << 14,
+};
+ENUM_CLASS_FLAGS(ECoreTweenProperty);
+
+/**
+ * Generational handle to a tween owned by UCoreTweenWorldSubsystem.
+ * Index addresses a slot in the subsystem's slot map; Generation is bumped
+ * every time that slot is recycled, so a stale handle never resolves to a
+ * newer tween that happens to reuse the slot.
+ */
+USTRUCT(BlueprintType)
+struct CORETWEEN_API FCoreTweenHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Index = INDEX_NONE;
+
+	UPROPERTY()
+	int32 Generation = 0;
+
+	FCoreTweenHandle() = default;
+	FCoreTweenHandle(const int32 InIndex, const int32 InGeneration)
+		: Index(InIndex)
+		, Generation(InGeneration)
+	{
+	}
+
+	/** @return true if this handle was ever issued. Does not mean the tween is still running. */
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	void Invalidate() { Index = INDEX_NONE; Generation = 0; }
+
+	bool operator==(const FCoreTweenHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+	bool operator!=(const FCoreTweenHandle& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FCoreTweenHandle& Handle)
+	{
+		return HashCombine(GetTypeHash(Handle.Index), GetTypeHash(Handle.Generation));
+	}
+};
@@ -22,22 +22,58 @@
 
 #pragma once
 
+#include "CoreTweenBatch.h"
 #include "CoreTweenBuilder.h"
+#include "CoreTweenComponentTransformBuffer.h"
+#include "CoreTweenMaterialParameterBuffer.h"
+#include "CoreTweenRenderTransformBuffer.h"
+#include "CoreTweenTypes.h"
+#include "Targets/SlateWidgetTweenTarget.h"
+#include "Targets/WidgetTweenTarget.h"
+#include "Containers/Map.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Templates/SharedPointer.h"
+#include "UObject/ObjectKey.h"
 
 #include "CoreTweenWorldSubsystem.generated.h"
 
+DECLARE_LOG_CATEGORY_EXTERN(LogCoreTween, Log, All);
+
 class UWidget;
+class FCoreTweenTimelinePlayer;
 struct FCoreTweenState;
 
 /**
- * Per-world storage for active tween states.
- * Replaces the former static TArray on UCoreTween so that PIE worlds
- * each get their own isolated set of tweens.
+ * Per-world owner and driver of active tweens.
+ * Every registered tween is advanced from this subsystem's tick, so a
+ * running tween costs no coroutine resume per frame. Tweens are bucketed
+ * into one FCoreTweenBatch per (time source, easing curve). Each tick has
+ * two phases: an evaluate phase (SIMD timing and easing, loop bookkeeping,
+ * property lerps) that touches no UObjects and runs over lane chunks with
+ * ParallelFor once enough tweens are running (CoreTween.ParallelThreshold),
+ * and a game-thread apply phase that writes targets and fires callbacks.
+ * Tween LOD (FCoreTweenLODSettings) throttles or skips the writes of tweens
+ * whose targets are hidden, transparent, off-screen, inactive or far away,
+ * and an apply budget (FCoreTweenBudgetSettings) defers Cosmetic writes on busy frames.
+ * Playing FCoreTweenTimelinePlayers are advanced after the batches. Render transform writes from
+ * every tween on a widget, and transform writes from every tween on a scene
+ * component, are merged and flushed once at the end of the pass. The TTask
+ * returned by FCoreTweenBuilder::Run() only waits on the tween's completion
+ * and is resumed after the batch.
+ *
+ * Tweens live in a generational slot map addressed by FCoreTweenHandle, and
+ * an object-keyed index makes per-widget (or per-actor) queries O(tweens on that object).
+ * Finished states and widget targets are recycled through per-world pools,
+ * so steady-state launches make no heap allocations.
+ *
+ * Each world gets its own instance, so PIE worlds keep tweens isolated.
+ *
+ * Profiling: "stat CoreTween" shows per-phase timings, active tweens per time
+ * source, launches and memory; the CoreTween trace channel marks each tween's
+ * lifetime in Unreal Insights; CoreTween.Dump lists the running tweens.
  */
 UCLASS()
-class CORETWEEN_API UCoreTweenWorldSubsystem : public UWorldSubsystem
+class CORETWEEN_API UCoreTweenWorldSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -46,24 +82,279 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
-	/** Register a new tween state for tracking. Called by FCoreTweenBuilder::Run(). */
-	void RegisterTweenState(TSharedPtr<FCoreTweenState> State);
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickableWhenPaused() const override { return true; }
+
+	/**
+	 * Register a new tween state. Applies its start values immediately. Called by FCoreTweenBuilder.
+	 * @return Handle to the new tween.
+	 */
+	FCoreTweenHandle RegisterTweenState(TSharedPtr<FCoreTweenState> State);
+
+	/** Pop a reset state from the pool, allocating only when the pool is empty. */
+	TSharedPtr<FCoreTweenState> AcquireState();
+
+	/** Pop a pooled widget target and bind it to Widget, allocating only when the pool is empty. */
+	TSharedPtr<FWidgetTweenTarget> AcquireWidgetTarget(UWidget* Widget);
+
+	/**
+	 * Widget's Slate transform and color, shared by every FSlateWidgetTweenTarget on it.
+	 * Created from the UWidget on first use and kept until ResetSlateWidgetState() or the widget dies.
+	 */
+	TSharedRef<FSlateWidgetTweenState> AcquireSlateWidgetState(UWidget* Widget);
 
-	/** Cancel all active tweens on the given widget. Returns number cancelled. */
-	int32 Clear(UWidget* Widget);
+	/** Drop Widget's Slate state so the next Slate tween reseeds from the UWidget. Called when a UMG tween takes the widget over. */
+	void ResetSlateWidgetState(UWidget* Widget);
 
-	/** @return true if any tween is actively running on this widget. */
-	bool GetIsTweening(UWidget* Widget);
+	/** Cancel all active tweens on the given widget, actor or component. Returns number cancelled. */
+	int32 Clear(UObject* Object);
 
-	/** Force-complete all active tweens. Each jumps to end state, fires OnComplete, and exits. */
+	/** @return true if any tween is actively running on this widget, actor or component. */
+	bool GetIsTweening(UObject* Object) const;
+
+	/** Force-complete all active tweens. Each jumps to end state, fires OnComplete, and exits on the next tick. */
 	void CompleteAll();
 
-	/** Accessor for the active tween states array. */
-	TArray<TSharedPtr<FCoreTweenState>>& GetActiveTweenStates() { return ActiveTweenStates; }
+	/** Freeze a tween in place. @return false if the handle is stale. */
+	bool Pause(FCoreTweenHandle Handle);
+
+	/** Unfreeze a paused tween. @return false if the handle is stale. */
+	bool Resume(FCoreTweenHandle Handle);
+
+	/** Force-complete a single tween: it jumps to its end state and fires OnComplete on the next tick. @return false if the handle is stale. */
+	bool Complete(FCoreTweenHandle Handle);
+
+	/** Cancel a single tween without firing OnComplete. @return false if the handle is stale. */
+	bool Cancel(FCoreTweenHandle Handle);
+
+	/**
+	 * Point a running tween's property at a new target in place: the tween keeps its
+	 * slot, lane and callbacks. An easing tween restarts its lap from the current
+	 * values and carries the current velocity into it, so the motion does not kink.
+	 * A follow tween keeps integrating toward the new target.
+	 * @param Property     Must be one of the properties the tween animates.
+	 * @param NewDuration  New lap duration; negative keeps the current one. Ignored in follow mode.
+	 * @param SetTarget    Writes the new target into the state.
+	 * @return false if the handle is stale, finished, or does not animate Property.
+	 */
+	bool Retarget(FCoreTweenHandle Handle, ECoreTweenProperty Property, float NewDuration, TFunctionRef<void(FCoreTweenState&)> SetTarget);
+
+	/** @return true if Handle refers to a tween that has not finished. */
+	bool IsActive(FCoreTweenHandle Handle) const;
+
+	/** Resolve a handle to its state. @return nullptr if the handle is stale. */
+	FCoreTweenState* Find(FCoreTweenHandle Handle) const;
+
+	/** Like Find(), but shares ownership, e.g. to keep the state alive while awaiting it. */
+	TSharedPtr<FCoreTweenState> FindShared(FCoreTweenHandle Handle) const;
+
+	/** Tick Player each frame, after the tween batches, until it stops playing. */
+	void AddTimelinePlayer(const TSharedRef<FCoreTweenTimelinePlayer>& Player);
+
+	/** Run Launch once this pass's write buffers have flushed; at once when no pass is running. */
+	void LaunchAfterFlush(TFunction<void()> Launch);
+
+	/** Tween LOD settings for this world. Tweens can override the policy with FCoreTweenBuilder::SetLODPolicy(). */
+	const FCoreTweenLODSettings& GetLODSettings() const { return LODSettings; }
+	void SetLODSettings(const FCoreTweenLODSettings& InSettings);
+
+	/** Apply budget for this world. Tweens opt into deferral with FCoreTweenBuilder::SetPriority(ECoreTweenPriority::Cosmetic). */
+	const FCoreTweenBudgetSettings& GetBudgetSettings() const { return BudgetSettings; }
+	void SetBudgetSettings(const FCoreTweenBudgetSettings& InSettings);
+
+	/** Ticks per second of the FixedStep time source. Changing it drops the partial step accumulated so far. */
+	int32 GetFixedStepRate() const { return FixedStepRate; }
+	void SetFixedStepRate(int32 Hz);
+
+	/** Whole fixed steps run since Initialize. */
+	int64 GetFixedStepTick() const { return FixedStepTick; }
+
+	/**
+	 * Run NumSteps fixed steps right away, e.g. to scrub a replay forward. Only
+	 * timing and callbacks advance on all but the last step, so the cost per
+	 * step is one batch kernel pass. Not callable from inside a tween callback.
+	 */
+	void FastForwardFixedStep(int32 NumSteps);
+
+	/** Approximate heap bytes owned by this subsystem: slot map, batches, pools and every live or pooled state. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Log every active tween with its target, time source, state and remaining time. Backs CoreTween.Dump. */
+	void Dump(FOutputDevice& Ar) const;
 
 private:
-	/** Prune finished entries from the tracking array. */
+	static constexpr int32 NumTimeSources = 4;
+
+	/** One entry in the slot map. Generation is bumped every time the slot is released. */
+	struct FTweenSlot
+	{
+		TSharedPtr<FCoreTweenState> State;
+
+		/** Entries of ObjectIndex holding this slot: the target object, then any extra target objects. */
+		TArray<TObjectKey<UObject>, TInlineAllocator<1>> ObjectKeys;
+		int32 Generation = 0;
+	};
+
+	/** A run of lanes in one batch, evaluated as one ParallelFor task. */
+	struct FEvaluateChunk
+	{
+		int32 BatchIndex = 0;
+		int32 StartLane = 0;
+		int32 NumLanes = 0;
+	};
+
+	/** Which batches one TickBatches() pass covers and how it treats them. */
+	struct FBatchPass
+	{
+		/** Bit per ECoreTweenTimeSource. */
+		uint32 SourceMask = 0;
+
+		/** False for a FixedStep presentation-only pass: no time is stepped. */
+		bool bAdvance = true;
+
+		/** Advance() skips the property lerp, unless the tween follows. Intermediate fixed steps. */
+		bool bTimingOnly = false;
+
+		/** FixedStep: seconds past the last whole step the properties are presented at. 0 presents the step itself. */
+		float PresentOffset = 0.0f;
+	};
+
+	/** Evaluate the pass's non-empty batches (in parallel above the threshold), then commit each lane on the game thread. */
+	void TickBatches(const float (&SourceDeltas)[NumTimeSources], const FBatchPass& Pass);
+
+	/** Evaluate phase for one chunk: batch kernels, then FCoreTweenState::Advance() per lane. Worker-thread safe. */
+	void EvaluateChunk(const FEvaluateChunk& Chunk, const float (&SourceDeltas)[NumTimeSources], const FBatchPass& Pass);
+
+	/** Apply phase for one lane: Commit(), then finish the tween or refresh its relevance. */
+	void CommitLane(FCoreTweenState& State, bool bDeferWrite);
+
+	/** Commit the Cosmetic lanes collected by a pass with what is left of the apply budget. */
+	void CommitCosmeticLanes(uint64 PassStartCycles);
+
+	/** Run NumSteps FixedStep passes, the last one presented at PresentOffset. */
+	void TickFixedSteps(int32 NumSteps, float PresentOffset);
+
+	/** Advance every playing timeline player and drop the ones that stopped. */
+	void TickTimelinePlayers(const float (&SourceDeltas)[NumTimeSources]);
+
+	/** Seconds until State completes, delay and remaining loops included. Negative if it never completes on its own. */
+	float GetRemainingTime(const FCoreTweenState& State) const;
+
+	/** Delta for the given time source this frame. Resolved once per tick, not per tween. */
+	float GetTimeSourceDelta(ECoreTweenTimeSource Source) const;
+
+	/** Mark a state finished, cancel its flow if requested, and queue its waiter for resumption. */
+	void FinishTween(const TSharedPtr<FCoreTweenState>& State, bool bCancel);
+
+	/** Resume coroutines waiting on finished tweens and recycle their slots. */
+	void ResumeFinishedWaiters();
+
+	/** Run the launches queued during the pass. Called once the buffer scopes have closed. */
+	void RunPostFlushLaunches();
+
+	/** Return a finished tween's slot to the free list and drop it from the object index. */
+	void ReleaseSlot(const FCoreTweenHandle& Handle);
+
+	/** Reset State (and its pooled target) back into the pools if nothing else references it. */
+	void RecycleState(TSharedPtr<FCoreTweenState>&& State);
+
+	/** Prune finished lanes from the batches. Must run before their slots are released. */
 	void PruneFinished();
 
-	TArray<TSharedPtr<FCoreTweenState>> ActiveTweenStates;
+	/** Batch that owns tweens with this time source and easing curve. */
+	FCoreTweenBatch& GetBatch(ECoreTweenTimeSource Source, ECoreTweenEasingType Easing);
+
+	/** Push a state's current lane rate (after pause/resume) into its batch. */
+	void SyncLaneRate(FCoreTweenState& State);
+
+	/** The LOD policy in effect for State: its override, else the world's. */
+	ECoreTweenLODPolicy ResolveLODPolicy(const FCoreTweenState& State) const;
+
+	/** Evaluate phase: whether State's properties are lerped and written this frame. */
+	bool ShouldEvaluate(const FCoreTweenState& State) const;
+
+	/** Apply phase: re-check State's relevance if it is due this frame. */
+	void UpdateRelevance(FCoreTweenState& State);
+
+	/** Viewport bounds and player view points, gathered on the first relevance check of a tick. */
+	const FCoreTweenRelevanceContext& GetRelevanceContext();
+
+	/** Generational slot map of every live tween. */
+	TArray<FTweenSlot> Slots;
+
+	/** Indices of released slots, reused LIFO. */
+	TArray<int32> FreeSlots;
+
+	/** Remove SlotIndex from Key's entry in ObjectIndex, dropping the entry once it is empty. */
+	void RemoveFromObjectIndex(const TObjectKey<UObject>& Key, int32 SlotIndex);
+
+	/** Slot indices of the tweens running on each target object, extra target objects included. */
+	TMap<TObjectKey<UObject>, TArray<int32, TInlineAllocator<2>>> ObjectIndex;
+
+	/** NumTimeSources * FCoreTweenEasing::NumEasingTypes batches, indexed by GetBatch(). */
+	TArray<FCoreTweenBatch> Batches;
+
+	/** Cosmetic lanes of the current apply pass, committed last. Capacity reused. */
+	TArray<FCoreTweenState*> CosmeticLanes;
+
+	/** Chunk list for this tick's evaluate phase. Rebuilt each tick, capacity reused. */
+	TArray<FEvaluateChunk> EvaluateChunks;
+
+	/** Tweens registered while the batch is running; merged once the loop is done. */
+	TArray<TSharedPtr<FCoreTweenState>> PendingStates;
+
+	/** Launches queued during the pass by LaunchAfterFlush(); run once the write buffers have flushed. */
+	TArray<TFunction<void()>> PostFlushLaunches;
+
+	/** Finished tweens whose waiting coroutines still have to be resumed. */
+	TArray<TSharedPtr<FCoreTweenState>> FinishedStates;
+
+	/** Scratch swapped with FinishedStates while resuming, so neither array reallocates. */
+	TArray<TSharedPtr<FCoreTweenState>> ResumingStates;
+
+	/** Reset states ready for reuse. */
+	TArray<TSharedPtr<FCoreTweenState>> StatePool;
+
+	/** Per-widget render transform writes merged during the batch pass. */
+	FCoreTweenRenderTransformBuffer RenderTransformBuffer;
+
+	/** Per-component world and relative transform writes merged during the batch pass. */
+	FCoreTweenComponentTransformBuffer ComponentTransformBuffer;
+
+	/** Per-material parameter writes merged during the batch pass. */
+	FCoreTweenMaterialParameterBuffer MaterialParameterBuffer;
+
+	/** Playing timeline players. Kept alive here until they stop. */
+	TArray<TSharedPtr<FCoreTweenTimelinePlayer>> TimelinePlayers;
+
+	/** Unbound widget targets ready for reuse. */
+	TArray<TSharedPtr<FWidgetTweenTarget>> WidgetTargetPool;
+
+	/** Slate-side transform and color of each widget animated through CreateSlate(). */
+	TMap<TObjectKey<UWidget>, TSharedPtr<FSlateWidgetTweenState>> SlateWidgetStates;
+
+	FCoreTweenLODSettings LODSettings;
+	FCoreTweenBudgetSettings BudgetSettings;
+
+	/** BudgetSettings.ApplyBudgetMs in cycles, and apply time spent so far this frame. */
+	uint64 ApplyBudgetCycles = 0;
+	uint64 ApplyCyclesSpent = 0;
+	FCoreTweenRelevanceContext RelevanceContext;
+	bool bRelevanceContextValid = false;
+
+	/** Ticks since Initialize. Staggers throttled writes and relevance checks across tweens. */
+	uint32 FrameCounter = 0;
+
+	/** FixedStep time source: rate in Hz, step length, unconsumed game time and steps run so far. */
+	int32 FixedStepRate = 60;
+	float FixedStepSize = 1.0f / 60.0f;
+	double FixedStepAccumulator = 0.0;
+	int64 FixedStepTick = 0;
+
+	/** This world's share of STAT_CoreTweenMemory, as of the last tick. */
+	SIZE_T ReportedMemory = 0;
+
+	bool bIsTicking = false;
 };
@@ -0,0 +1,114 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Shared scaffolding of the write buffers (render transform, component
+ * transform, material parameter): the active-buffer scope and one entry per
+ * written object, in first-write order. The derived buffer defines what an
+ * entry holds, how writes merge into it and how Flush() writes it out.
+ *
+ * UCoreTweenWorldSubsystem opens an FScope around its batch. Outside a scope
+ * GetActive() returns nullptr and targets write immediately.
+ *
+ * DerivedType declares the storage for its active buffer,
+ * `static DerivedType* Active;`, and befriends this base. Keeping it on the
+ * exported derived class gives every module the same active buffer.
+ */
+template <typename DerivedType, typename ObjectType, typename EntryType>
+class TCoreTweenWriteBuffer
+{
+public:
+	/** Makes Buffer the active buffer for its lifetime and flushes it on exit. Game thread only. */
+	class FScope
+	{
+	public:
+		explicit FScope(DerivedType& InBuffer)
+			: Buffer(InBuffer)
+			, Previous(ActiveBuffer())
+		{
+			check(IsInGameThread());
+			ActiveBuffer() = &Buffer;
+		}
+
+		~FScope()
+		{
+			ActiveBuffer() = Previous;
+			Buffer.Flush();
+		}
+
+		FScope(const FScope&) = delete;
+		FScope& operator=(const FScope&) = delete;
+
+	private:
+		DerivedType& Buffer;
+		DerivedType* Previous;
+	};
+
+	/** @return The buffer of the innermost open scope, or nullptr. */
+	static DerivedType* GetActive() { return ActiveBuffer(); }
+
+	/** @return Number of objects with a pending write. */
+	int32 Num() const { return Entries.Num(); }
+
+protected:
+	/** Object's entry. bOutAdded is set when it had none since the last flush and the entry is default-constructed. */
+	EntryType& FindOrAddEntry(ObjectType* Object, bool& bOutAdded)
+	{
+		const TObjectKey<ObjectType> Key(Object);
+		if (const int32* ExistingIndex = EntryIndex.Find(Key))
+		{
+			bOutAdded = false;
+			return Entries[*ExistingIndex];
+		}
+
+		bOutAdded = true;
+		EntryIndex.Add(Key, Entries.Num());
+		return Entries.AddDefaulted_GetRef();
+	}
+
+	/** @return Object's entry, or nullptr if nothing was merged for it since the last flush. */
+	const EntryType* FindEntry(const ObjectType* Object) const
+	{
+		const int32* Index = Object ? EntryIndex.Find(TObjectKey<ObjectType>(Object)) : nullptr;
+		return Index ? &Entries[*Index] : nullptr;
+	}
+
+	/** Drop every entry, keeping the allocations for the next batch. Call at the end of Flush(). */
+	void ResetEntries()
+	{
+		Entries.Reset();
+		EntryIndex.Reset();
+	}
+
+	/** Pending writes in first-write order. Flush() may reorder them; EntryIndex is rebuilt after the next reset. */
+	TArray<EntryType> Entries;
+	TMap<TObjectKey<ObjectType>, int32> EntryIndex;
+
+private:
+	static DerivedType*& ActiveBuffer() { return DerivedType::Active; }
+};
@@ -19,3 +19,27 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
+
+#pragma once
+
+#include "Targets/SceneComponentTweenTarget.h"
+
+class AActor;
+
+/**
+ * ICoreTweenTarget implementation for AActor.
+ * Tweens the actor's root component through FSceneComponentTweenTarget, so
+ * actor moves share the same single-write, batched transform path. The
+ * actor is held weakly; IsTargetValid() fails once it is destroyed or has
+ * no root component.
+ */
+class CORETWEEN_API FActorTweenTarget : public FSceneComponentTweenTarget
+{
+public:
+	explicit FActorTweenTarget(AActor* InActor, ETeleportType InTeleport = ETeleportType::None);
+
+	virtual bool IsTargetValid() const override;
+
+private:
+	TWeakObjectPtr<AActor> Actor;
+};
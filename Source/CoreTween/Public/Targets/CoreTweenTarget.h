@@ -22,10 +22,65 @@
 
 #pragma once
 
+#include "CoreTweenTypes.h"
 #include "Math/Vector2D.h"
 #include "Math/Vector4.h"
 #include "Math/Color.h"
+#include "Math/Quat.h"
+#include "Math/Transform.h"
 #include "Components/SlateWrapperTypes.h"
+#include "Containers/Array.h"
+#include "Layout/SlateRect.h"
+
+class UObject;
+struct FCoreTweenState;
+
+/**
+ * Render transform components written by one tween in one frame.
+ * Only the components flagged in Components are written; the rest keep the
+ * target's current value. Shear is carried so a combined write never clobbers it.
+ */
+struct FCoreTweenRenderTransform
+{
+	FVector2D Translation = FVector2D::ZeroVector;
+	FVector2D Scale = FVector2D::UnitVector;
+	FVector2D Shear = FVector2D::ZeroVector;
+	float Angle = 0.0f;
+
+	/** Any of ECoreTweenProperty::Translation, Scale, Rotation. */
+	ECoreTweenProperty Components = ECoreTweenProperty::None;
+};
+
+/**
+ * World transform components written by one tween in one frame.
+ * Only the components flagged in Components are written; the rest keep the
+ * target's current world value.
+ */
+struct FCoreTweenWorldTransform
+{
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector Scale3D = FVector::OneVector;
+
+	/** Any of ECoreTweenProperty::Location, Orientation, Scale3D. */
+	ECoreTweenProperty Components = ECoreTweenProperty::None;
+};
+
+/**
+ * Per-tick inputs to ICoreTweenTarget::IsRelevant(). Built once per tick by
+ * UCoreTweenWorldSubsystem, only on ticks where some tween is checked.
+ */
+struct FCoreTweenRelevanceContext
+{
+	/** Game viewport bounds in Slate absolute space. Empty when the world has no game viewport. */
+	FSlateRect ViewportRect = FSlateRect(0.0f, 0.0f, 0.0f, 0.0f);
+
+	/** View points of the world's local players. */
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+
+	/** Squared FCoreTweenLODSettings::MaxViewDistance. 0 disables the distance test. */
+	double MaxViewDistanceSquared = 0.0;
+};
 
 /**
  * Abstraction layer for tween property targets.
@@ -41,35 +96,102 @@ public:
 	/** @return true if the underlying target object is still alive. */
 	virtual bool IsTargetValid() const = 0;
 
-	// ── Read current values (for "from current" behavior) ───────────
-
-	virtual FVector2D GetCurrentTranslation() const = 0;
-	virtual FVector2D GetCurrentScale() const = 0;
-	virtual float GetCurrentOpacity() const = 0;
-	virtual FLinearColor GetCurrentColor() const = 0;
-	virtual float GetCurrentRotation() const = 0;
-	virtual FVector2D GetCurrentCanvasPosition() const = 0;
-	virtual FVector4 GetCurrentPadding() const = 0;
-	virtual ESlateVisibility GetCurrentVisibility() const = 0;
-	virtual float GetCurrentMaxDesiredHeight() const = 0;
-
-	// ── Apply interpolated values ───────────────────────────────────
-
-	virtual void ApplyTranslation(const FVector2D& Value) = 0;
-	virtual void ApplyScale(const FVector2D& Value) = 0;
-	virtual void ApplyOpacity(float Value) = 0;
-	virtual void ApplyColor(const FLinearColor& Value) = 0;
-	virtual void ApplyRotation(float Value) = 0;
-	virtual void ApplyCanvasPosition(const FVector2D& Value) = 0;
-	virtual void ApplyPadding(const FVector4& Value) = 0;
-	virtual void ApplyVisibility(ESlateVisibility Value) = 0;
-	virtual void ApplyMaxDesiredHeight(float Value) = 0;
-
-	// ── Actor property access (future — not yet implemented) ────────
-	// When FActorTweenTarget is built, add:
-	//   virtual FVector    GetCurrentLocation() const = 0;
-	//   virtual FRotator   GetCurrentActorRotation() const = 0;
-	//   virtual void ApplyLocation(const FVector& Value) = 0;
-	//   virtual void ApplyActorRotation(const FRotator& Value) = 0;
+	/**
+	 * Tween LOD hook. Game thread only.
+	 * @param AnimatedProperties Properties the tween drives; a target never
+	 *                           culls on a property the tween itself animates.
+	 * @return false if writes to this target are currently not worth making.
+	 */
+	virtual bool IsRelevant(const FCoreTweenRelevanceContext& Context, ECoreTweenProperty AnimatedProperties) const { return true; }
+
+	/** Called when the tween driving this target is cancelled (not when it completes). */
+	virtual void OnTweenCancelled() {}
+
+	/**
+	 * Called once when a builder hands its configuration to a tween state,
+	 * before the state is registered. Targets that drive their own timing
+	 * (see FStaggerTweenTarget) can take over the state's applier and easing here.
+	 */
+	virtual void OnTweenLaunched(FCoreTweenState& State) {}
+
+	/**
+	 * Objects written besides the tween's TargetObject, for targets that span
+	 * several (see FStaggerTweenTarget). The subsystem indexes the tween under
+	 * each, so Clear(), GetIsTweening() and non-additive launches on any of them find it.
+	 */
+	virtual void GetExtraTargetObjects(TArray<UObject*>& OutObjects) const {}
+
+	/**
+	 * Called by Clear(Object) for an object reported by GetExtraTargetObjects().
+	 * @return true if the target stopped writing Object and keeps running on the
+	 *         rest; false to cancel the whole tween.
+	 */
+	virtual bool ReleaseTargetObject(const UObject* Object) { return false; }
+
+	// ── Widget properties ───────────────────────────────────────────
+	// Not pure: only widget targets see these properties.
+
+	virtual FVector2D GetCurrentTranslation() const { return FVector2D::ZeroVector; }
+	virtual FVector2D GetCurrentScale() const { return FVector2D::UnitVector; }
+	virtual float GetCurrentOpacity() const { return 1.0f; }
+	virtual FLinearColor GetCurrentColor() const { return FLinearColor::White; }
+	virtual float GetCurrentRotation() const { return 0.0f; }
+	virtual FVector2D GetCurrentCanvasPosition() const { return FVector2D::ZeroVector; }
+	virtual FVector4 GetCurrentPadding() const { return FVector4(0.0f, 0.0f, 0.0f, 0.0f); }
+	virtual ESlateVisibility GetCurrentVisibility() const { return ESlateVisibility::Visible; }
+	virtual float GetCurrentMaxDesiredHeight() const { return 0.0f; }
+
+	virtual void ApplyTranslation(const FVector2D& Value) {}
+	virtual void ApplyScale(const FVector2D& Value) {}
+	virtual void ApplyOpacity(float Value) {}
+	virtual void ApplyColor(const FLinearColor& Value) {}
+	virtual void ApplyRotation(float Value) {}
+	virtual void ApplyCanvasPosition(const FVector2D& Value) {}
+	virtual void ApplyPadding(const FVector4& Value) {}
+	virtual void ApplyVisibility(ESlateVisibility Value) {}
+	virtual void ApplyMaxDesiredHeight(float Value) {}
+
+	/**
+	 * Write all flagged render transform components in one call.
+	 * The default forwards each flagged component to its single-component applier;
+	 * targets that can set the whole transform at once should override it.
+	 */
+	virtual void ApplyRenderTransform(const FCoreTweenRenderTransform& Value)
+	{
+		if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Translation))
+		{
+			ApplyTranslation(Value.Translation);
+		}
+		if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Scale))
+		{
+			ApplyScale(Value.Scale);
+		}
+		if (EnumHasAnyFlags(Value.Components, ECoreTweenProperty::Rotation))
+		{
+			ApplyRotation(Value.Angle);
+		}
+	}
+
+	// ── World-space properties (actors and scene components) ────────
+	// Not pure: only actor and component targets see these properties.
+
+	virtual FVector GetCurrentLocation() const { return FVector::ZeroVector; }
+	virtual FQuat GetCurrentOrientation() const { return FQuat::Identity; }
+	virtual FVector GetCurrentScale3D() const { return FVector::OneVector; }
+	virtual FTransform GetCurrentRelativeTransform() const { return FTransform::Identity; }
+
+	/** Write all flagged world transform components in one call. */
+	virtual void ApplyWorldTransform(const FCoreTweenWorldTransform& Value) {}
+
+	virtual void ApplyRelativeTransform(const FTransform& Value) {}
+
+	// ── Material parameters ─────────────────────────────────────────
+	// Not pure: only material targets see these properties.
+
+	virtual float GetCurrentMaterialScalar() const { return 0.0f; }
+	virtual FLinearColor GetCurrentMaterialVector() const { return FLinearColor::Black; }
+
+	virtual void ApplyMaterialScalar(float Value) {}
+	virtual void ApplyMaterialVector(const FLinearColor& Value) {}
 };
 
@@ -0,0 +1,66 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "Targets/CoreTweenTarget.h"
+#include "UObject/NameTypes.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UMaterialInstanceDynamic;
+
+/**
+ * ICoreTweenTarget implementation for one parameter of a UMaterialInstanceDynamic.
+ * Tweens the parameter as a scalar (MaterialScalar) or a vector (MaterialVector);
+ * both address the same ParameterName. Covers widget brush MIDs
+ * (UImage::GetDynamicMaterial()) and mesh MIDs
+ * (UPrimitiveComponent::CreateDynamicMaterialInstance()) alike.
+ *
+ * The parameter's index in the instance is looked up by name once, on the
+ * first write, and every later write goes through SetScalar/VectorParameterByIndex.
+ * Inside the subsystem's batch, writes are merged per MID by
+ * FCoreTweenMaterialParameterBuffer.
+ *
+ * Other properties are ignored. Holds the material via TWeakObjectPtr;
+ * IsTargetValid() returns false if it has been garbage collected.
+ */
+class CORETWEEN_API FMaterialTweenTarget : public ICoreTweenTarget
+{
+public:
+	FMaterialTweenTarget(UMaterialInstanceDynamic* InMaterial, FName InParameterName);
+
+	virtual bool IsTargetValid() const override;
+
+	virtual float GetCurrentMaterialScalar() const override;
+	virtual FLinearColor GetCurrentMaterialVector() const override;
+
+	virtual void ApplyMaterialScalar(float Value) override;
+	virtual void ApplyMaterialVector(const FLinearColor& Value) override;
+
+protected:
+	TWeakObjectPtr<UMaterialInstanceDynamic> Material;
+	FName ParameterName;
+
+	/** Cached parameter slots in the instance. INDEX_NONE until the first write. */
+	int32 ScalarIndex = INDEX_NONE;
+	int32 VectorIndex = INDEX_NONE;
+};
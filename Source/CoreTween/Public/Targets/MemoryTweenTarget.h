@@ -0,0 +1,90 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "Targets/CoreTweenTarget.h"
+
+/**
+ * ICoreTweenTarget that keeps every property in plain members instead of on
+ * an object. Reads return the stored values and writes overwrite them, so a
+ * tween can be run and inspected without a widget, actor or world.
+ * Used with FCoreTweenSimulation for headless runs and benchmarks.
+ */
+class CORETWEEN_API FMemoryTweenTarget : public ICoreTweenTarget
+{
+public:
+	virtual bool IsTargetValid() const override { return bValid; }
+
+	virtual FVector2D GetCurrentTranslation() const override { return Translation; }
+	virtual FVector2D GetCurrentScale() const override { return Scale; }
+	virtual float GetCurrentOpacity() const override { return Opacity; }
+	virtual FLinearColor GetCurrentColor() const override { return Color; }
+	virtual float GetCurrentRotation() const override { return Rotation; }
+	virtual FVector2D GetCurrentCanvasPosition() const override { return CanvasPosition; }
+	virtual FVector4 GetCurrentPadding() const override { return Padding; }
+	virtual ESlateVisibility GetCurrentVisibility() const override { return Visibility; }
+	virtual float GetCurrentMaxDesiredHeight() const override { return MaxDesiredHeight; }
+	virtual FVector GetCurrentLocation() const override { return Location; }
+	virtual FQuat GetCurrentOrientation() const override { return Orientation; }
+	virtual FVector GetCurrentScale3D() const override { return Scale3D; }
+	virtual FTransform GetCurrentRelativeTransform() const override { return RelativeTransform; }
+	virtual float GetCurrentMaterialScalar() const override { return MaterialScalar; }
+	virtual FLinearColor GetCurrentMaterialVector() const override { return MaterialVector; }
+
+	virtual void ApplyTranslation(const FVector2D& Value) override;
+	virtual void ApplyScale(const FVector2D& Value) override;
+	virtual void ApplyOpacity(float Value) override;
+	virtual void ApplyColor(const FLinearColor& Value) override;
+	virtual void ApplyRotation(float Value) override;
+	virtual void ApplyCanvasPosition(const FVector2D& Value) override;
+	virtual void ApplyPadding(const FVector4& Value) override;
+	virtual void ApplyVisibility(ESlateVisibility Value) override;
+	virtual void ApplyMaxDesiredHeight(float Value) override;
+	virtual void ApplyRenderTransform(const FCoreTweenRenderTransform& Value) override;
+	virtual void ApplyWorldTransform(const FCoreTweenWorldTransform& Value) override;
+	virtual void ApplyRelativeTransform(const FTransform& Value) override;
+	virtual void ApplyMaterialScalar(float Value) override;
+	virtual void ApplyMaterialVector(const FLinearColor& Value) override;
+
+	FVector2D Translation = FVector2D::ZeroVector;
+	FVector2D Scale = FVector2D::UnitVector;
+	float Opacity = 1.0f;
+	FLinearColor Color = FLinearColor::White;
+	float Rotation = 0.0f;
+	FVector2D CanvasPosition = FVector2D::ZeroVector;
+	FVector4 Padding = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+	ESlateVisibility Visibility = ESlateVisibility::Visible;
+	float MaxDesiredHeight = 0.0f;
+	FVector Location = FVector::ZeroVector;
+	FQuat Orientation = FQuat::Identity;
+	FVector Scale3D = FVector::OneVector;
+	FTransform RelativeTransform = FTransform::Identity;
+	float MaterialScalar = 0.0f;
+	FLinearColor MaterialVector = FLinearColor::Black;
+
+	/** Clear to simulate the target object dying: the tween ends on its next commit. */
+	bool bValid = true;
+
+	/** Apply calls received, merged transform writes counting once. */
+	int32 NumWrites = 0;
+};
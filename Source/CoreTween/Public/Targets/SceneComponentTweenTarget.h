@@ -19,3 +19,43 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
+
+#pragma once
+
+#include "Targets/CoreTweenTarget.h"
+#include "Engine/EngineTypes.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class USceneComponent;
+
+/**
+ * ICoreTweenTarget implementation for USceneComponent.
+ * Tweens world location, rotation (quaternion slerp) and 3D scale, and the
+ * relative transform. All components a tween changes in one frame are written
+ * with a single SetWorldTransform() — no sweep, using the configured
+ * ETeleportType — and, inside the subsystem's batch, writes from every tween
+ * on the component are merged by FCoreTweenComponentTransformBuffer.
+ *
+ * Widget properties are ignored. Holds the component via TWeakObjectPtr;
+ * IsTargetValid() returns false if it has been garbage collected.
+ */
+class CORETWEEN_API FSceneComponentTweenTarget : public ICoreTweenTarget
+{
+public:
+	explicit FSceneComponentTweenTarget(USceneComponent* InComponent, ETeleportType InTeleport = ETeleportType::None);
+
+	virtual bool IsTargetValid() const override;
+	virtual bool IsRelevant(const FCoreTweenRelevanceContext& Context, ECoreTweenProperty AnimatedProperties) const override;
+
+	virtual FVector GetCurrentLocation() const override;
+	virtual FQuat GetCurrentOrientation() const override;
+	virtual FVector GetCurrentScale3D() const override;
+	virtual FTransform GetCurrentRelativeTransform() const override;
+
+	virtual void ApplyWorldTransform(const FCoreTweenWorldTransform& Value) override;
+	virtual void ApplyRelativeTransform(const FTransform& Value) override;
+
+protected:
+	TWeakObjectPtr<USceneComponent> Component;
+	ETeleportType Teleport = ETeleportType::None;
+};
@@ -0,0 +1,96 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "Targets/WidgetTweenTarget.h"
+#include "Slate/WidgetTransform.h"
+#include "Templates/SharedPointer.h"
+
+class SWidget;
+
+/**
+ * Render transform and color of a widget driven through FSlateWidgetTweenTarget.
+ * Slate writes never reach the UWidget, so this is the only up-to-date copy:
+ * every Slate target on the widget shares one instance, handed out by
+ * UCoreTweenWorldSubsystem::AcquireSlateWidgetState(). Seeded from the UWidget.
+ */
+struct CORETWEEN_API FSlateWidgetTweenState
+{
+	explicit FSlateWidgetTweenState(UWidget* InWidget);
+
+	TWeakObjectPtr<UWidget> Widget;
+	FWidgetTransform Transform;
+	FLinearColor Color = FLinearColor::White;
+};
+
+/**
+ * ICoreTweenTarget for hot HUD elements (crosshair pulses, hit markers).
+ * Resolves the widget's SWidget and its color sink once, then writes render
+ * transform, opacity and color straight to Slate — no UWidget setters, no
+ * per-frame casts, no logging. Each write is a single Slate attribute set.
+ *
+ * Transform and color are tracked in an FSlateWidgetTweenState shared by all
+ * Slate targets on the widget, so chained and additive Slate tweens start
+ * from and merge into each other's values. The UWidget's RenderTransform and
+ * ColorAndOpacity properties are not updated. Use it for widgets whose UMG
+ * properties are not read back while the tween runs. Every other property
+ * goes through the FWidgetTweenTarget path.
+ */
+class CORETWEEN_API FSlateWidgetTweenTarget : public FWidgetTweenTarget
+{
+public:
+	/** @param InState Widget's shared state; a private one seeded from the UWidget if null. */
+	explicit FSlateWidgetTweenTarget(UWidget* InWidget, TSharedPtr<FSlateWidgetTweenState> InState = nullptr);
+
+	virtual FVector2D GetCurrentTranslation() const override;
+	virtual FVector2D GetCurrentScale() const override;
+	virtual float GetCurrentOpacity() const override;
+	virtual FLinearColor GetCurrentColor() const override;
+	virtual float GetCurrentRotation() const override;
+
+	virtual void ApplyTranslation(const FVector2D& Value) override;
+	virtual void ApplyScale(const FVector2D& Value) override;
+	virtual void ApplyOpacity(float Value) override;
+	virtual void ApplyColor(const FLinearColor& Value) override;
+	virtual void ApplyRotation(float Value) override;
+	virtual void ApplyRenderTransform(const FCoreTweenRenderTransform& Value) override;
+
+private:
+	/** Which Slate setter receives color. Resolved once from the UWidget's class. */
+	enum class EColorSink : uint8
+	{
+		None,
+		Image,
+		Compound
+	};
+
+	/** Resolve the SWidget, retrying if the UWidget had not built it yet. */
+	SWidget* ResolveSlateWidget();
+
+	/** Push the shared transform to Slate. */
+	void WriteRenderTransform();
+
+	TSharedRef<FSlateWidgetTweenState> State;
+	TWeakPtr<SWidget> WeakSlateWidget;
+	EColorSink ColorSink = EColorSink::None;
+};
@@ -0,0 +1,112 @@
+﻿// MIT License
+//
+// Copyright (c) 2026 José M. Nieves
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "CoreTweenBuilder.h"
+#include "CoreTweenTypes.h"
+#include "Targets/WidgetTweenTarget.h"
+#include "Containers/ArrayView.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UWidget;
+
+/**
+ * ICoreTweenTarget for a group of widgets animated with one staggered tween
+ * (UCoreTween::CreateStaggered()). A single linear driver state spans the whole
+ * group. Each widget plays the builder's properties and easing over the
+ * per-widget duration, shifted by its stagger offset.
+ *
+ * Starts and targets the builder set explicitly are shared through the driver
+ * state. Only the "from current" side of each property differs per widget, so
+ * only that is stored, in one compact column per animated property. Evaluate
+ * eases every widget's alpha in one pass, and Write lerps and writes only the
+ * widgets whose alpha changed.
+ */
+class CORETWEEN_API FStaggerTweenTarget final : public ICoreTweenTarget
+{
+public:
+	FStaggerTweenTarget(TArrayView<UWidget* const> InWidgets, float StaggerDelay, ECoreTweenStaggerOrder Order);
+
+	/** True while any widget of the group is alive. */
+	virtual bool IsTargetValid() const override;
+
+	/** Capture per-widget values, stretch the driver over the group and take over its easing and applier. */
+	virtual void OnTweenLaunched(FCoreTweenState& State) override;
+
+	/** The group's widgets, so the subsystem indexes the driver under each of them. */
+	virtual void GetExtraTargetObjects(TArray<UObject*>& OutObjects) const override;
+
+	/** Drop one widget from the group, leaving it where it is. The rest keep playing. */
+	virtual bool ReleaseTargetObject(const UObject* Object) override;
+
+	/** Applier of the driver tween. The driver is linear, so its alpha maps straight back to group time. */
+	static void Apply(FCoreTweenState& State, float EasedAlpha, ECoreTweenApplyPhase Phase);
+
+	int32 Num() const { return Widgets.Num(); }
+
+	/** Offset of the last widget to start. */
+	float GetSpan() const { return Span; }
+
+private:
+	/** Evaluate phase: every widget's eased alpha at group time Time. Worker-thread safe. */
+	void Evaluate(FCoreTweenState& State, float Time);
+
+	/** Write phase: lerp and write the widgets whose alpha changed since their last write. */
+	void Write(FCoreTweenState& State);
+
+	TArray<TWeakObjectPtr<UWidget>> Widgets;
+
+	/** Start offset per widget, in seconds. */
+	TArray<float> Offsets;
+
+	/** Eased alpha per widget from the last evaluate. */
+	TArray<float> Alpha;
+
+	/** Alpha each widget was last written at. Negative until the first write. */
+	TArray<float> WrittenAlpha;
+
+	/** Easing parameter per widget, for FCoreTweenEasing::EaseBatch(). All the same. */
+	TArray<float> Params;
+
+	// Per-widget "from current" values, filled only for animated properties missing a start or a target.
+	TArray<FVector2D> TranslationValues;
+	TArray<FVector2D> ScaleValues;
+	TArray<FLinearColor> ColorValues;
+	TArray<float> OpacityValues;
+	TArray<float> RotationValues;
+	TArray<FVector2D> CanvasPositionValues;
+	TArray<FVector4> PaddingValues;
+	TArray<ESlateVisibility> VisibilityValues;
+	TArray<float> MaxDesiredHeightValues;
+
+	/** Shared curve taken from the driver state. */
+	ECoreTweenEasingType EasingType = ECoreTweenEasingType::Linear;
+	TSharedPtr<const FCoreTweenEasingLUT> EasingCurve;
+
+	/** Duration of each widget's animation. */
+	float ItemDuration = 0.0f;
+	float Span = 0.0f;
+
+	/** Rebound to each widget in turn for writes, so render transforms still merge through the subsystem's buffer. */
+	FWidgetTweenTarget Writer;
+};
@@ -43,6 +43,7 @@ public:
 	explicit FWidgetTweenTarget(UWidget* InWidget);
 
 	virtual bool IsTargetValid() const override;
+	virtual bool IsRelevant(const FCoreTweenRelevanceContext& Context, ECoreTweenProperty AnimatedProperties) const override;
 
 	virtual FVector2D GetCurrentTranslation() const override;
 	virtual FVector2D GetCurrentScale() const override;
@@ -64,8 +65,14 @@ public:
 	virtual void ApplyVisibility(ESlateVisibility Value) override;
 	virtual void ApplyMaxDesiredHeight(float Value) override;
 
+	/** Merges into the active FCoreTweenRenderTransformBuffer, or does one Get/SetRenderTransform round-trip. */
+	virtual void ApplyRenderTransform(const FCoreTweenRenderTransform& Value) override;
+
 	UWidget* GetWidget() const;
 
+	/** Rebind to another widget. Used when the subsystem recycles pooled targets. */
+	void SetWidget(UWidget* InWidget);
+
 private:
 	TWeakObjectPtr<UWidget> WeakWidget;
 };
@@ -29,6 +29,9 @@
 #include "Components/Widget.h"
 #include "Engine/Engine.h"
 #include "Engine/GameViewportClient.h"
+#include "RenderCore.h"
+#include "Scalability.h"
+#include "Settings/UnrealCoreFrameworkSettings.h"
 #include "UI/AnimatableWidgetInterface.h"
 #include "UI/CoreWidget.h"
 #include "UI/UiCoreFrameworkTypes.h"
@@ -36,67 +39,49 @@
 #include "AsyncFlow.h"
 #include "AsyncFlowAwaiters.h"
 
+DEFINE_LOG_CATEGORY(LogCoreTweenManager);
+
 void UTweenManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UTweenManagerSubsystem::Tick));
+	ViewportResizedHandle = FViewport::ViewportResizedEvent.AddUObject(this, &UTweenManagerSubsystem::HandleViewportResized);
 }
 
 void UTweenManagerSubsystem::Deinitialize()
 {
-	if (ActiveAnimationTask.IsValid() && !ActiveAnimationTask.IsCompleted())
-	{
-		ActiveAnimationTask.Cancel();
-	}
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+	FViewport::ViewportResizedEvent.Remove(ViewportResizedHandle);
+	ViewportResizedHandle.Reset();
+
+	// The tweens belong to their worlds and finish or die with them; completion no longer reaches us.
+	ActiveTransitions.Empty();
 	Super::Deinitialize();
 }
 
-void UTweenManagerSubsystem::PlayWidgetTransitionEffect(
+FCoreTweenHandle UTweenManagerSubsystem::PlayWidgetTransitionEffect(
 	UCoreWidget*						 Widget,
 	const FWidgetTweenTransitionOptions& TransitionOptions,
 	EWidgetTransitionMode				 TransitionMode)
 {
 	if (!Widget)
 	{
-		return;
+		return FCoreTweenHandle();
 	}
 
-	if (!ShouldPlayAnimations())
-	{
-		if (IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget))
-		{
-			AnimatableWidget->OnAnimationCompleted(TransitionMode);
-		}
-		return;
-	}
-
-	AsyncFlow::TTask<void> Task;
-	switch (TransitionOptions.TransitionType)
-	{
-		case EWidgetTransitionType::Scale:
-			Task = PlayScaleAnimationTask(Widget, TransitionOptions, TransitionMode);
-			break;
-		case EWidgetTransitionType::Translation:
-			Task = PlayTranslationAnimationTask(Widget, TransitionOptions, TransitionMode);
-			break;
-		case EWidgetTransitionType::Fade:
-			Task = PlayFadeAnimationTask(Widget, TransitionOptions, TransitionMode);
-			break;
-		default:
-			if (IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget))
-			{
-				AnimatableWidget->OnAnimationCompleted(TransitionMode);
-			}
-			return;
-	}
+	EnsureViewportGeometry();
 
-	if (IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget))
+	FWidgetTweenTransitionOptions Options = TransitionOptions;
+	if (!ApplyTransitionQuality(Options, TransitionMode))
 	{
-		AnimatableWidget->OnAnimationStarted(TransitionMode);
+		SkipTransition(Widget, TransitionOptions, TransitionMode);
+		return FCoreTweenHandle();
 	}
 
-	ActiveAnimationTask = MoveTemp(Task);
-	ActiveAnimationTask.SetDebugName(FString::Printf(TEXT("WidgetTransition_%s"), *Widget->GetName()));
-	ActiveAnimationTask.Start();
+	return PlayTransitionTween(Widget, MakeTransitionTween(Options, TransitionMode), TransitionMode);
 }
 
 AsyncFlow::TTask<void> UTweenManagerSubsystem::PlayWidgetTransitionEffectTask(
@@ -111,233 +96,511 @@ AsyncFlow::TTask<void> UTweenManagerSubsystem::PlayWidgetTransitionEffectTask(
 		co_return;
 	}
 
-	if (!ShouldPlayAnimations())
+	const FCoreTweenHandle Handle = PlayWidgetTransitionEffect(Widget, TransitionOptions, TransitionMode);
+
+	// Resumed by the world's batched tick when the tween completes, or when it is cancelled or superseded.
+	co_await UCoreTween::WaitForCompletion(Widget, Handle);
+}
+
+FCoreTweenHandle UTweenManagerSubsystem::GetWidgetTransition(UCoreWidget* Widget) const
+{
+	const FActiveWidgetTransition* Transition = Widget ? ActiveTransitions.Find(Widget) : nullptr;
+	if (!Transition || !UCoreTween::IsActive(Widget, Transition->Tween))
 	{
-		if (IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget))
-		{
-			AnimatableWidget->OnAnimationCompleted(TransitionMode);
-		}
-		co_return;
+		return FCoreTweenHandle();
 	}
+	return Transition->Tween;
+}
 
-	switch (TransitionOptions.TransitionType)
+bool UTweenManagerSubsystem::CancelWidgetTransition(UCoreWidget* Widget)
+{
+	FActiveWidgetTransition Transition;
+	if (!Widget || !ActiveTransitions.RemoveAndCopyValue(Widget, Transition))
 	{
-		case EWidgetTransitionType::Scale:
-		{
-			if (IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget))
-			{
-				AnimatableWidget->OnAnimationStarted(TransitionMode);
-			}
-			co_await PlayScaleAnimationTask(Widget, TransitionOptions, TransitionMode);
-			break;
-		}
-		case EWidgetTransitionType::Translation:
-		{
-			if (IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget))
-			{
-				AnimatableWidget->OnAnimationStarted(TransitionMode);
-			}
-			co_await PlayTranslationAnimationTask(Widget, TransitionOptions, TransitionMode);
-			break;
-		}
-		case EWidgetTransitionType::Fade:
-		{
-			if (IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget))
-			{
-				AnimatableWidget->OnAnimationStarted(TransitionMode);
-			}
-			co_await PlayFadeAnimationTask(Widget, TransitionOptions, TransitionMode);
-			break;
-		}
-		default:
-		{
-			if (IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget))
-			{
-				AnimatableWidget->OnAnimationCompleted(TransitionMode);
-			}
-			break;
-		}
+		return false;
 	}
-
-	co_return;
+	return UCoreTween::Cancel(Widget, Transition.Tween);
 }
 
 bool UTweenManagerSubsystem::PlayPresetAnimation(
 	UCoreWidget*		  Widget,
 	const FName&		  PresetName,
 	EWidgetTransitionMode TransitionMode)
+{
+	const FWidgetTransitionPresetHandle PresetHandle = FindAnimationPreset(PresetName);
+	if (!PresetHandle.IsValid())
+	{
+		UE_LOG(LogCoreTweenManager, Warning, TEXT("[TweenManager] Animation preset '%s' not found"), *PresetName.ToString());
+		return false;
+	}
+
+	return PlayPresetAnimationByHandle(Widget, PresetHandle, TransitionMode);
+}
+
+bool UTweenManagerSubsystem::PlayPresetAnimationByHandle(
+	UCoreWidget*						Widget,
+	const FWidgetTransitionPresetHandle PresetHandle,
+	const EWidgetTransitionMode			TransitionMode)
 {
 	if (!Widget)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UTweenManagerSubsystem: Cannot play preset for null widget"));
+		UE_LOG(LogCoreTweenManager, Warning, TEXT("[TweenManager] Cannot play preset for null widget"));
 		return false;
 	}
 
-	if (!AnimationPresets.Contains(PresetName))
+	if (!AnimationPresets.IsValidIndex(PresetHandle.Index))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UTweenManagerSubsystem: Animation preset '%s' not found"), *PresetName.ToString());
+		UE_LOG(LogCoreTweenManager, Warning, TEXT("[TweenManager] Invalid animation preset handle %d"), PresetHandle.Index);
 		return false;
 	}
 
-	PlayWidgetTransitionEffect(Widget, AnimationPresets[PresetName], TransitionMode);
+	const FCompiledTransitionPreset& Preset = AnimationPresets[PresetHandle.Index];
+
+	// FadeOnly and Instant rewrite the transition itself; only then go back to the options.
+	if (TransitionQuality > EWidgetTransitionQuality::Shortened)
+	{
+		PlayWidgetTransitionEffect(Widget, Preset.Options, TransitionMode);
+		return true;
+	}
+
+	EnsureViewportGeometry();
+	PlayTransitionTween(Widget, Preset.Tweens[static_cast<uint8>(TransitionMode)], TransitionMode, GetTransitionDurationScale());
 	return true;
 }
 
+FWidgetTransitionPresetHandle UTweenManagerSubsystem::FindAnimationPreset(const FName PresetName) const
+{
+	FWidgetTransitionPresetHandle PresetHandle;
+	if (const int32* Index = AnimationPresetIndices.Find(PresetName))
+	{
+		PresetHandle.Index = *Index;
+	}
+	return PresetHandle;
+}
+
+FWidgetTransitionPresetHandle UTweenManagerSubsystem::RegisterAnimationPreset(const FName PresetName, const FWidgetTweenTransitionOptions& Options)
+{
+	EnsureViewportGeometry();
+
+	int32& Index = AnimationPresetIndices.FindOrAdd(PresetName, INDEX_NONE);
+	if (Index == INDEX_NONE)
+	{
+		Index = AnimationPresets.AddDefaulted();
+	}
+
+	FCompiledTransitionPreset& Preset = AnimationPresets[Index];
+	Preset.Name = PresetName;
+	Preset.Options = Options;
+	CompilePreset(Preset);
+
+	FWidgetTransitionPresetHandle PresetHandle;
+	PresetHandle.Index = Index;
+	return PresetHandle;
+}
+
 void UTweenManagerSubsystem::RegisterAnimationPresets(const TMap<FName, FWidgetTweenTransitionOptions>& Presets)
 {
-	AnimationPresets.Append(Presets);
+	for (const TPair<FName, FWidgetTweenTransitionOptions>& Preset : Presets)
+	{
+		RegisterAnimationPreset(Preset.Key, Preset.Value);
+	}
 }
 
 bool UTweenManagerSubsystem::ShouldPlayAnimations() const
 {
+	return TransitionQuality != EWidgetTransitionQuality::Instant;
+}
+
+float UTweenManagerSubsystem::GetTransitionDurationScale() const
+{
+	if (TransitionQuality == EWidgetTransitionQuality::Full)
+	{
+		return 1.0f;
+	}
+	return UUnrealCoreFrameworkSettings::GetSettings()->TransitionGovernor.ShortenedDurationScale;
+}
+
+bool UTweenManagerSubsystem::Tick(const float DeltaTime)
+{
+	TickTransitionGovernor(DeltaTime);
+	PruneTransitions();
 	return true;
 }
 
-AsyncFlow::TTask<void> UTweenManagerSubsystem::PlayScaleAnimationTask(
+void UTweenManagerSubsystem::TickTransitionGovernor(const float DeltaTime)
+{
+	const FWidgetTransitionGovernorSettings& Settings = UUnrealCoreFrameworkSettings::GetSettings()->TransitionGovernor;
+	if (!Settings.bEnabled)
+	{
+		TransitionQuality = EWidgetTransitionQuality::Full;
+		SmoothedFrameLoadMs = 0.0f;
+		RecoveryElapsed = 0.0f;
+		return;
+	}
+
+	// Whichever of the threads or the GPU is the bottleneck sets the load. These exclude idle time,
+	// so a frame rate cap or vsync wait does not count as load the way DeltaTime would.
+	const float FrameLoadMs = FMath::Max3(
+		static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime)),
+		static_cast<float>(FPlatformTime::ToMilliseconds(GRenderThreadTime)),
+		static_cast<float>(FPlatformTime::ToMilliseconds(GGPUFrameTime)));
+
+	// Moving average over the sample window. A single hitch moves it at most a quarter of the way.
+	const float Window = FMath::Max(Settings.SampleWindowSeconds, 0.05f);
+	const float Alpha = FMath::Min(DeltaTime, Window * 0.25f) / Window;
+	SmoothedFrameLoadMs = FMath::Lerp(SmoothedFrameLoadMs, FrameLoadMs, Alpha);
+
+	EWidgetTransitionQuality LoadQuality = EWidgetTransitionQuality::Full;
+	if (SmoothedFrameLoadMs >= Settings.InstantFrameTimeMs)
+	{
+		LoadQuality = EWidgetTransitionQuality::Instant;
+	}
+	else if (SmoothedFrameLoadMs >= Settings.FadeOnlyFrameTimeMs)
+	{
+		LoadQuality = EWidgetTransitionQuality::FadeOnly;
+	}
+	else if (SmoothedFrameLoadMs >= Settings.ShortenedFrameTimeMs)
+	{
+		LoadQuality = EWidgetTransitionQuality::Shortened;
+	}
+
+	// The tier is read from effects quality, the group UI transitions belong to, so one other group set to Low does not cap them.
+	if (Settings.LowTierScalabilityLevel >= 0
+		&& Scalability::GetQualityLevels().EffectsQuality <= Settings.LowTierScalabilityLevel)
+	{
+		LoadQuality = FMath::Max(LoadQuality, Settings.LowTierQuality);
+	}
+
+	// Degrade at once; recover one tier at a time, after the load has stayed low for RecoveryDelaySeconds.
+	EWidgetTransitionQuality NewQuality = TransitionQuality;
+	if (LoadQuality > TransitionQuality)
+	{
+		NewQuality = LoadQuality;
+		RecoveryElapsed = 0.0f;
+	}
+	else if (LoadQuality < TransitionQuality)
+	{
+		RecoveryElapsed += DeltaTime;
+		if (RecoveryElapsed >= Settings.RecoveryDelaySeconds)
+		{
+			NewQuality = static_cast<EWidgetTransitionQuality>(static_cast<uint8>(TransitionQuality) - 1);
+			RecoveryElapsed = 0.0f;
+		}
+	}
+	else
+	{
+		RecoveryElapsed = 0.0f;
+	}
+
+	if (NewQuality != TransitionQuality)
+	{
+		UE_LOG(LogCoreTweenManager, Verbose, TEXT("[TweenManager] Transition quality %s -> %s (load %.1f ms)"),
+			*UEnum::GetValueAsString(TransitionQuality), *UEnum::GetValueAsString(NewQuality), SmoothedFrameLoadMs);
+		TransitionQuality = NewQuality;
+	}
+}
+
+void UTweenManagerSubsystem::CompilePreset(FCompiledTransitionPreset& Preset) const
+{
+	Preset.Tweens[static_cast<uint8>(EWidgetTransitionMode::Intro)] = MakeTransitionTween(Preset.Options, EWidgetTransitionMode::Intro);
+	Preset.Tweens[static_cast<uint8>(EWidgetTransitionMode::Outro)] = MakeTransitionTween(Preset.Options, EWidgetTransitionMode::Outro);
+}
+
+void UTweenManagerSubsystem::EnsureViewportGeometry()
+{
+	if (ViewportSize != FIntPoint::ZeroValue || !GEngine || !GEngine->GameViewport || !GEngine->GameViewport->Viewport)
+	{
+		return;
+	}
+	SetViewportSize(GEngine->GameViewport->Viewport->GetSizeXY());
+}
+
+void UTweenManagerSubsystem::HandleViewportResized(FViewport* Viewport, uint32 Unused)
+{
+	// Fires for every viewport, editor ones included.
+	if (!Viewport || !GEngine || !GEngine->GameViewport || GEngine->GameViewport->Viewport != Viewport)
+	{
+		return;
+	}
+	SetViewportSize(Viewport->GetSizeXY());
+}
+
+void UTweenManagerSubsystem::SetViewportSize(const FIntPoint NewSize)
+{
+	if (NewSize == ViewportSize)
+	{
+		return;
+	}
+	ViewportSize = NewSize;
+
+	for (FCompiledTransitionPreset& Preset : AnimationPresets)
+	{
+		if (Preset.Options.TransitionType == EWidgetTransitionType::Translation && Preset.Options.UseViewportAsTranslationOrigin)
+		{
+			CompilePreset(Preset);
+		}
+	}
+}
+
+void UTweenManagerSubsystem::PruneTransitions()
+{
+	for (auto It = ActiveTransitions.CreateIterator(); It; ++It)
+	{
+		UCoreWidget* Widget = It.Value().Widget.Get();
+		if (!Widget || !UCoreTween::IsActive(Widget, It.Value().Tween))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool UTweenManagerSubsystem::ApplyTransitionQuality(FWidgetTweenTransitionOptions& InOutOptions, const EWidgetTransitionMode TransitionMode) const
+{
+	const FWidgetTransitionGovernorSettings& Settings = UUnrealCoreFrameworkSettings::GetSettings()->TransitionGovernor;
+	switch (TransitionQuality)
+	{
+		case EWidgetTransitionQuality::Full:
+			return true;
+		case EWidgetTransitionQuality::Shortened:
+			InOutOptions.TransitionTime *= Settings.ShortenedDurationScale;
+			return true;
+		case EWidgetTransitionQuality::FadeOnly:
+		{
+			InOutOptions.TransitionType = EWidgetTransitionType::Fade;
+			InOutOptions.TransitionTime = FMath::Min(InOutOptions.TransitionTime, Settings.FadeOnlyDuration);
+
+			// A transition authored without a fade would play nothing visible.
+			if (FMath::IsNearlyEqual(InOutOptions.FadeFrom, InOutOptions.FadeTo))
+			{
+				const bool bIntro = TransitionMode == EWidgetTransitionMode::Intro;
+				InOutOptions.FadeFrom = bIntro ? 0.0f : 1.0f;
+				InOutOptions.FadeTo = bIntro ? 1.0f : 0.0f;
+			}
+			return true;
+		}
+		case EWidgetTransitionQuality::Instant:
+		default:
+			return false;
+	}
+}
+
+void UTweenManagerSubsystem::SkipTransition(
 	UCoreWidget*						 Widget,
 	const FWidgetTweenTransitionOptions& TransitionOptions,
-	EWidgetTransitionMode				 TransitionMode)
+	const EWidgetTransitionMode			 TransitionMode)
 {
-	UCF_ASYNC_CONTRACT(this);
-
-	const FVector2D Start = TransitionOptions.ScaleFrom;
-	const FVector2D End = TransitionOptions.ScaleTo;
-	const float		StartOpacity = TransitionOptions.FadeFrom;
-	const float		EndOpacity = TransitionOptions.FadeTo;
-
-	co_await CreateAndPlayTweenTask(Widget,
-		Start, End,
-		FVector2D::ZeroVector, FVector2D::ZeroVector,
-		StartOpacity, EndOpacity,
-		TransitionOptions.TransitionTime,
-		TransitionOptions.EasingType,
-		TransitionMode);
+	CompleteSupersededTransition(Widget);
+	ActiveTransitions.Remove(Widget);
+	SnapToTransitionEnd(Widget, TransitionOptions, TransitionMode);
+	if (IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget))
+	{
+		AnimatableWidget->OnAnimationCompleted(TransitionMode);
+	}
 }
 
-AsyncFlow::TTask<void> UTweenManagerSubsystem::PlayTranslationAnimationTask(
+void UTweenManagerSubsystem::SnapToTransitionEnd(
 	UCoreWidget*						 Widget,
 	const FWidgetTweenTransitionOptions& TransitionOptions,
-	EWidgetTransitionMode				 TransitionMode)
+	const EWidgetTransitionMode			 TransitionMode) const
 {
-	UCF_ASYNC_CONTRACT(this);
+	UCoreTween::Clear(Widget);
 
-	Widget->ForceLayoutPrepass();
+	FVector2D EndScale = FVector2D::UnitVector;
+	FVector2D EndTranslation = FVector2D::ZeroVector;
+	if (TransitionOptions.TransitionType == EWidgetTransitionType::Scale)
+	{
+		EndScale = TransitionOptions.ScaleTo;
+	}
+	else if (TransitionOptions.TransitionType == EWidgetTransitionType::Translation)
+	{
+		FVector2D Start;
+		ResolveTranslationVectors(TransitionOptions, TransitionMode, Start, EndTranslation);
+	}
 
-	co_await AsyncFlow::NextTick(this);
+	Widget->SetRenderScale(EndScale);
+	Widget->SetRenderTranslation(EndTranslation);
+	Widget->SetRenderOpacity(TransitionOptions.FadeTo);
+}
 
-	TWeakObjectPtr<UCoreWidget> WeakWidget = Widget;
-	if (!WeakWidget.IsValid())
+UTweenManagerSubsystem::FWidgetTransitionTween UTweenManagerSubsystem::MakeTransitionTween(
+	const FWidgetTweenTransitionOptions& TransitionOptions,
+	const EWidgetTransitionMode			 TransitionMode) const
+{
+	FWidgetTransitionTween Tween;
+	Tween.StartOpacity = TransitionOptions.FadeFrom;
+	Tween.EndOpacity = TransitionOptions.FadeTo;
+	Tween.Duration = TransitionOptions.TransitionTime;
+	Tween.EasingType = TransitionOptions.EasingType;
+	Tween.EasingParam = FCoreTweenEasing::GetDefaultParam(TransitionOptions.EasingType);
+
+	switch (TransitionOptions.TransitionType)
 	{
-		co_return;
+		case EWidgetTransitionType::Scale:
+			Tween.StartScale = TransitionOptions.ScaleFrom;
+			Tween.EndScale = TransitionOptions.ScaleTo;
+			break;
+		case EWidgetTransitionType::Translation:
+			Tween.bTranslation = true;
+			ResolveTranslationVectors(TransitionOptions, TransitionMode, Tween.StartTranslation, Tween.EndTranslation);
+			break;
+		case EWidgetTransitionType::Fade:
+		default:
+			break;
 	}
+	return Tween;
+}
 
-	FVector2D Start = FVector2D::ZeroVector;
-	FVector2D End = FVector2D::ZeroVector;
+FCoreTweenHandle UTweenManagerSubsystem::PlayTransitionTween(
+	UCoreWidget*				  Widget,
+	const FWidgetTransitionTween& Tween,
+	const EWidgetTransitionMode	  TransitionMode,
+	const float					  DurationScale)
+{
+	CompleteSupersededTransition(Widget);
 
-	if (TransitionOptions.UseViewportAsTranslationOrigin)
+	IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget);
+	if (AnimatableWidget)
 	{
-		GetViewportTranslationVectors(TransitionOptions.WidgetTranslationType, Start, End);
-		Start += TransitionOptions.TranslationFromOffset;
-		End += TransitionOptions.TranslationToOffset;
+		AnimatableWidget->OnAnimationStarted(TransitionMode);
+	}
 
-		if (TransitionMode == EWidgetTransitionMode::Outro)
+	const FCoreTweenHandle Handle = StartWidgetTransition(Widget, Tween, TransitionMode, DurationScale);
+	if (!Handle.IsValid() && AnimatableWidget)
+	{
+		// No world to run in; don't leave the widget waiting for a completion that never comes.
+		AnimatableWidget->OnAnimationCompleted(TransitionMode);
+	}
+	return Handle;
+}
+
+void UTweenManagerSubsystem::CompleteSupersededTransition(UCoreWidget* Widget)
+{
+	const FActiveWidgetTransition* Running = ActiveTransitions.Find(Widget);
+	if (!Running || !UCoreTween::IsActive(Widget, Running->Tween))
+	{
+		return;
+	}
+
+	// Its tween is cancelled by the one that replaces it, so its OnComplete never fires.
+	if (IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget))
+	{
+		AnimatableWidget->OnAnimationCompleted(Running->TransitionMode);
+	}
+}
+
+FCoreTweenHandle UTweenManagerSubsystem::StartWidgetTransition(
+	UCoreWidget*				  Widget,
+	const FWidgetTransitionTween& Tween,
+	const EWidgetTransitionMode	  TransitionMode,
+	const float					  DurationScale)
+{
+	if (Tween.bTranslation)
+	{
+		Widget->ForceLayoutPrepass();
+	}
+
+	// Merge into a transition that is still running: leave the From values unset so the
+	// new tween starts where the old one got to instead of snapping back to its start.
+	const FActiveWidgetTransition* Running = ActiveTransitions.Find(Widget);
+	const bool bMerge = Running && UCoreTween::IsActive(Widget, Running->Tween);
+
+	// Non-additive: registering this tween cancels the one it supersedes.
+	FCoreTweenBuilder Builder = UCoreTween::Create(Widget, Tween.Duration * DurationScale);
+	if (!bMerge)
+	{
+		Builder.FromScale(Tween.StartScale)
+			.FromTranslation(Tween.StartTranslation)
+			.FromOpacity(Tween.StartOpacity);
+	}
+
+	const TWeakObjectPtr<UCoreWidget> WeakWidget = Widget;
+	const FCoreTweenHandle Handle = Builder
+		.ToScale(Tween.EndScale)
+		.ToTranslation(Tween.EndTranslation)
+		.ToOpacity(Tween.EndOpacity)
+		.Easing(Tween.EasingType, Tween.EasingParam)
+		.OnComplete(FCoreTweenSignature::CreateWeakLambda(this, [this, WeakWidget, TransitionMode]()
 		{
-			Swap(Start, End);
-		}
+			OnWidgetTransitionCompleted(WeakWidget.Get(), TransitionMode);
+		}))
+		.Start(Widget);
+
+	if (Handle.IsValid())
+	{
+		ActiveTransitions.Add(Widget, { WeakWidget, Handle, TransitionMode });
 	}
 	else
 	{
-		Start = TransitionOptions.TranslationFrom + TransitionOptions.TranslationFromOffset;
-		End = TransitionOptions.TranslationTo + TransitionOptions.TranslationToOffset;
+		ActiveTransitions.Remove(Widget);
+	}
+	return Handle;
+}
+
+void UTweenManagerSubsystem::OnWidgetTransitionCompleted(UCoreWidget* Widget, const EWidgetTransitionMode TransitionMode)
+{
+	if (!IsValid(Widget))
+	{
+		return;
 	}
 
-	co_await CreateAndPlayTweenTask(WeakWidget.Get(),
-		FVector2D::UnitVector, FVector2D::UnitVector,
-		Start, End,
-		TransitionOptions.FadeFrom, TransitionOptions.FadeTo,
-		TransitionOptions.TransitionTime,
-		TransitionOptions.EasingType,
-		TransitionMode);
+	ActiveTransitions.Remove(Widget);
+	if (IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget))
+	{
+		AnimatableWidget->OnAnimationCompleted(TransitionMode);
+	}
 }
 
-AsyncFlow::TTask<void> UTweenManagerSubsystem::PlayFadeAnimationTask(
-	UCoreWidget*						 Widget,
+void UTweenManagerSubsystem::ResolveTranslationVectors(
 	const FWidgetTweenTransitionOptions& TransitionOptions,
-	EWidgetTransitionMode				 TransitionMode)
+	const EWidgetTransitionMode			 TransitionMode,
+	FVector2D&							 OutStart,
+	FVector2D&							 OutEnd) const
 {
-	UCF_ASYNC_CONTRACT(this);
+	OutStart = FVector2D::ZeroVector;
+	OutEnd = FVector2D::ZeroVector;
 
-	co_await CreateAndPlayTweenTask(Widget,
-		FVector2D::UnitVector, FVector2D::UnitVector,
-		FVector2D::ZeroVector, FVector2D::ZeroVector,
-		TransitionOptions.FadeFrom, TransitionOptions.FadeTo,
-		TransitionOptions.TransitionTime,
-		TransitionOptions.EasingType,
-		TransitionMode);
+	if (TransitionOptions.UseViewportAsTranslationOrigin)
+	{
+		GetViewportTranslationVectors(TransitionOptions.WidgetTranslationType, OutStart, OutEnd);
+		OutStart += TransitionOptions.TranslationFromOffset;
+		OutEnd += TransitionOptions.TranslationToOffset;
+
+		if (TransitionMode == EWidgetTransitionMode::Outro)
+		{
+			Swap(OutStart, OutEnd);
+		}
+	}
+	else
+	{
+		OutStart = TransitionOptions.TranslationFrom + TransitionOptions.TranslationFromOffset;
+		OutEnd = TransitionOptions.TranslationTo + TransitionOptions.TranslationToOffset;
+	}
 }
 
 void UTweenManagerSubsystem::GetViewportTranslationVectors(
 	const EWidgetTranslationType TranslationType,
 	FVector2D&					 OutStart,
-	FVector2D&					 OutEnd)
+	FVector2D&					 OutEnd) const
 {
-	if (!GEngine || !GEngine->GameViewport || !GEngine->GameViewport->Viewport)
-	{
-		OutStart = FVector2D::ZeroVector;
-		OutEnd = FVector2D::ZeroVector;
-		return;
-	}
+	OutEnd = FVector2D::ZeroVector;
 
-	const FVector2D ViewportSize = FVector2D(GEngine->GameViewport->Viewport->GetSizeXY());
+	const FVector2D Size(ViewportSize);
 	switch (TranslationType)
 	{
 		case EWidgetTranslationType::FromLeft:
-			OutStart = FVector2D(-ViewportSize.X, 0);
+			OutStart = FVector2D(-Size.X, 0);
 			break;
 		case EWidgetTranslationType::FromRight:
-			OutStart = FVector2D(ViewportSize.X, 0);
+			OutStart = FVector2D(Size.X, 0);
 			break;
 		case EWidgetTranslationType::FromTop:
-			OutStart = FVector2D(0, -ViewportSize.Y);
+			OutStart = FVector2D(0, -Size.Y);
 			break;
 		case EWidgetTranslationType::FromBottom:
-			OutStart = FVector2D(0, ViewportSize.Y);
+			OutStart = FVector2D(0, Size.Y);
 			break;
 		default:
 			OutStart = FVector2D::ZeroVector;
 			break;
 	}
 }
-
-AsyncFlow::TTask<void> UTweenManagerSubsystem::CreateAndPlayTweenTask(
-	UCoreWidget*	 Widget,
-	const FVector2D& StartScale, const FVector2D& EndScale,
-	const FVector2D& StartTranslation, const FVector2D& EndTranslation,
-	const float StartOpacity, const float EndOpacity, const float Duration,
-	const ECoreTweenEasingType EasingType, const EWidgetTransitionMode TransitionMode)
-{
-	UCF_ASYNC_CONTRACT(this);
-
-	if (!Widget)
-	{
-		co_return;
-	}
-
-	co_await UCoreTween::Create(Widget, Duration)
-		.FromScale(StartScale)
-		.ToScale(EndScale)
-		.FromTranslation(StartTranslation)
-		.ToTranslation(EndTranslation)
-		.FromOpacity(StartOpacity)
-		.ToOpacity(EndOpacity)
-		.Easing(EasingType)
-		.Run(this);
-
-	if (IsValid(Widget))
-	{
-		if (IAnimatableWidgetInterface* AnimatableWidget = Cast<IAnimatableWidgetInterface>(Widget))
-		{
-			AnimatableWidget->OnAnimationCompleted(TransitionMode);
-		}
-	}
-}
@@ -61,10 +61,14 @@ void UCoreWidget::Show()
 			PlayTweenTransition(CoreWidgetAnimationSettings.TweenEntranceOptions, EWidgetTransitionMode::Intro);
 			break;
 		case EWidgetAnimationType::WidgetAnimation:
-			if (IntroAnimation)
+			if (ShouldPlayUmgAnimation(IntroAnimation))
 			{
 				PlayWidgetAnimation(IntroAnimation, IntroAnimationOptions, EWidgetTransitionMode::Intro);
 			}
+			else if (IntroAnimation)
+			{
+				PlayTweenTransition(CoreWidgetAnimationSettings.TweenEntranceOptions, EWidgetTransitionMode::Intro);
+			}
 			else
 			{
 				InternalShown();
@@ -86,10 +90,14 @@ void UCoreWidget::Hide()
 			PlayTweenTransition(CoreWidgetAnimationSettings.TweenExitOptions, EWidgetTransitionMode::Outro);
 			break;
 		case EWidgetAnimationType::WidgetAnimation:
-			if (OutroAnimation)
+			if (ShouldPlayUmgAnimation(OutroAnimation))
 			{
 				PlayWidgetAnimation(OutroAnimation, OutroAnimationOptions, EWidgetTransitionMode::Outro);
 			}
+			else if (OutroAnimation)
+			{
+				PlayTweenTransition(CoreWidgetAnimationSettings.TweenExitOptions, EWidgetTransitionMode::Outro);
+			}
 			else
 			{
 				InternalHidden();
@@ -109,23 +117,24 @@ AsyncFlow::TTask<void> UCoreWidget::ShowTask()
 
 	const EWidgetAnimationType AnimType = CoreWidgetAnimationSettings.WidgetAnimationType;
 
-	if (AnimType == EWidgetAnimationType::WidgetAnimation && IntroAnimation)
+	if (AnimType == EWidgetAnimationType::WidgetAnimation && ShouldPlayUmgAnimation(IntroAnimation))
 	{
+		const float PlaybackSpeed = GetTransitionPlaybackSpeed(IntroAnimationOptions);
 		PlayAnimation(
 			IntroAnimation,
 			IntroAnimationOptions.StartAtTime,
 			IntroAnimationOptions.NumberOfLoops,
 			IntroAnimationOptions.PlayMode,
-			IntroAnimationOptions.PlaybackSpeed,
+			PlaybackSpeed,
 			IntroAnimationOptions.bRestoreState);
 
-		const float Duration = IntroAnimation->GetEndTime() / FMath::Max(IntroAnimationOptions.PlaybackSpeed, 0.01f);
+		const float Duration = IntroAnimation->GetEndTime() / FMath::Max(PlaybackSpeed, 0.01f);
 		co_await AsyncFlow::UnpausedDelay(this, Duration);
 		InternalShown();
 		co_return;
 	}
 
-	if (AnimType == EWidgetAnimationType::WidgetTween)
+	if (AnimType == EWidgetAnimationType::WidgetTween || (AnimType == EWidgetAnimationType::WidgetAnimation && IntroAnimation))
 	{
 		if (!IsValid(TweenManagerSubsystem))
 		{
@@ -148,23 +157,24 @@ AsyncFlow::TTask<void> UCoreWidget::HideTask()
 
 	const EWidgetAnimationType AnimType = CoreWidgetAnimationSettings.WidgetAnimationType;
 
-	if (AnimType == EWidgetAnimationType::WidgetAnimation && OutroAnimation)
+	if (AnimType == EWidgetAnimationType::WidgetAnimation && ShouldPlayUmgAnimation(OutroAnimation))
 	{
+		const float PlaybackSpeed = GetTransitionPlaybackSpeed(OutroAnimationOptions);
 		PlayAnimation(
 			OutroAnimation,
 			OutroAnimationOptions.StartAtTime,
 			OutroAnimationOptions.NumberOfLoops,
 			OutroAnimationOptions.PlayMode,
-			OutroAnimationOptions.PlaybackSpeed,
+			PlaybackSpeed,
 			OutroAnimationOptions.bRestoreState);
 
-		const float Duration = OutroAnimation->GetEndTime() / FMath::Max(OutroAnimationOptions.PlaybackSpeed, 0.01f);
+		const float Duration = OutroAnimation->GetEndTime() / FMath::Max(PlaybackSpeed, 0.01f);
 		co_await AsyncFlow::UnpausedDelay(this, Duration);
 		InternalHidden();
 		co_return;
 	}
 
-	if (AnimType == EWidgetAnimationType::WidgetTween)
+	if (AnimType == EWidgetAnimationType::WidgetTween || (AnimType == EWidgetAnimationType::WidgetAnimation && OutroAnimation))
 	{
 		if (!IsValid(TweenManagerSubsystem))
 		{
@@ -230,10 +240,31 @@ void UCoreWidget::PlayWidgetAnimation(UWidgetAnimation* Anim, const FWidgetAnima
 		WidgetAnimationOptions.StartAtTime,
 		WidgetAnimationOptions.NumberOfLoops,
 		WidgetAnimationOptions.PlayMode,
-		WidgetAnimationOptions.PlaybackSpeed,
+		GetTransitionPlaybackSpeed(WidgetAnimationOptions),
 		WidgetAnimationOptions.bRestoreState);
 }
 
+bool UCoreWidget::ShouldPlayAnimations() const
+{
+	return GetTransitionQuality() != EWidgetTransitionQuality::Instant;
+}
+
+EWidgetTransitionQuality UCoreWidget::GetTransitionQuality() const
+{
+	return IsValid(TweenManagerSubsystem) ? TweenManagerSubsystem->GetTransitionQuality() : EWidgetTransitionQuality::Full;
+}
+
+bool UCoreWidget::ShouldPlayUmgAnimation(const UWidgetAnimation* Animation) const
+{
+	return Animation && GetTransitionQuality() <= EWidgetTransitionQuality::Shortened;
+}
+
+float UCoreWidget::GetTransitionPlaybackSpeed(const FWidgetAnimationOptions& Options) const
+{
+	const float DurationScale = IsValid(TweenManagerSubsystem) ? TweenManagerSubsystem->GetTransitionDurationScale() : 1.0f;
+	return Options.PlaybackSpeed / FMath::Max(DurationScale, 0.01f);
+}
+
 void UCoreWidget::OnAnimationStarted(const EWidgetTransitionMode& TransitionMode)
 {
 }
@@ -24,6 +24,7 @@
 
 #include "Engine/DeveloperSettings.h"
 #include "UI/CorePage.h"
+#include "UI/UiCoreFrameworkTypes.h"
 
 #include "UnrealCoreFrameworkSettings.generated.h"
 
@@ -53,4 +54,8 @@ public:
 
 	UPROPERTY(EditAnywhere, config, BlueprintReadWrite, Category = UnrealCoreFrameworkSettings, Meta = (DisplayName = "Prompt"))
 	TSubclassOf<UCoreWidget> YesNoPrompt;
+
+	/** Frame-load thresholds that step UTweenManagerSubsystem transitions down from Full to Instant. */
+	UPROPERTY(EditAnywhere, config, BlueprintReadWrite, Category = UnrealCoreFrameworkSettings, Meta = (DisplayName = "Transition Governor"))
+	FWidgetTransitionGovernorSettings TransitionGovernor;
 };
@@ -25,11 +25,15 @@
 #include "SubSystems/Base/CoreGameInstanceSubsystem.h"
 #include "UI/UiCoreFrameworkTypes.h"
 #include "AsyncFlowTask.h"
+#include "Containers/Ticker.h"
+#include "CoreTweenEasing.h"
+#include "CoreTweenTypes.h"
 
 #include "TweenManagerSubsystem.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogCoreTweenManager, Log, All);
 
+class FViewport;
 class UCoreWidget;
 class UWidget;
 
@@ -42,67 +46,207 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
-	/** Play a widget transition effect (fire-and-forget Blueprint entry point) */
+	/**
+	 * Play a widget transition effect (fire-and-forget Blueprint entry point).
+	 * A transition already running on the widget is merged: the new one picks up
+	 * from the widget's current scale, translation and opacity, and the old one
+	 * reports completion before the new one reports its start.
+	 * @return Handle of the tween driving the transition; invalid if it finished synchronously.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "WidgetAnimation")
-	void PlayWidgetTransitionEffect(
+	FCoreTweenHandle PlayWidgetTransitionEffect(
 		UCoreWidget*						 Widget,
 		const FWidgetTweenTransitionOptions& TransitionOptions,
 		EWidgetTransitionMode				 TransitionMode);
 
 	/**
 	 * Play a widget transition effect as a coroutine.
-	 * Resolves when the animation completes.
+	 * Resolves when the transition completes, is cancelled, or is merged into a newer one.
 	 */
 	AsyncFlow::TTask<void> PlayWidgetTransitionEffectTask(
 		UCoreWidget* Widget,
 		const FWidgetTweenTransitionOptions& TransitionOptions,
 		EWidgetTransitionMode TransitionMode);
 
-	/** Play a preset animation */
+	/** Handle of the widget's running transition, or an invalid handle if it has none. O(1). */
+	UFUNCTION(BlueprintPure, Category = "WidgetAnimation")
+	FCoreTweenHandle GetWidgetTransition(UCoreWidget* Widget) const;
+
+	/** Stop the widget's running transition where it is, without reporting completion. O(1). */
+	UFUNCTION(BlueprintCallable, Category = "WidgetAnimation")
+	bool CancelWidgetTransition(UCoreWidget* Widget);
+
+	/** Play a preset animation by name. Hot paths should resolve a handle once and use PlayPresetAnimationByHandle(). */
 	UFUNCTION(BlueprintCallable, Category = "WidgetAnimation")
 	bool PlayPresetAnimation(
 		UCoreWidget*		  Widget,
 		const FName&		  PresetName,
 		EWidgetTransitionMode TransitionMode);
 
+	/** Play a compiled preset: an array index, no name hashing and no per-call geometry. */
+	UFUNCTION(BlueprintCallable, Category = "WidgetAnimation")
+	bool PlayPresetAnimationByHandle(
+		UCoreWidget*				  Widget,
+		FWidgetTransitionPresetHandle PresetHandle,
+		EWidgetTransitionMode		  TransitionMode);
+
+	/** Handle of a registered preset, or an invalid handle if the name is unknown. */
+	UFUNCTION(BlueprintPure, Category = "WidgetAnimation")
+	FWidgetTransitionPresetHandle FindAnimationPreset(FName PresetName) const;
+
+	/**
+	 * Compile a preset into a ready-to-run tween for each direction.
+	 * Registering an existing name recompiles it in place and keeps its handle.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "WidgetAnimation")
+	FWidgetTransitionPresetHandle RegisterAnimationPreset(FName PresetName, const FWidgetTweenTransitionOptions& Options);
+
 	/** Register animation presets */
 	void RegisterAnimationPresets(const TMap<FName, FWidgetTweenTransitionOptions>& Presets);
 
-	/** Should animations be played based on performance settings */
+	/** False when the transition governor has dropped transitions to Instant. */
+	UFUNCTION(BlueprintPure, Category = "WidgetAnimation")
 	bool ShouldPlayAnimations() const;
 
+	/**
+	 * Quality tier transitions currently play at, from the smoothed frame load
+	 * and the device's scalability tier. See FWidgetTransitionGovernorSettings.
+	 */
+	UFUNCTION(BlueprintPure, Category = "WidgetAnimation")
+	EWidgetTransitionQuality GetTransitionQuality() const { return TransitionQuality; }
+
+	/** Duration multiplier at the current tier: 1 at Full, ShortenedDurationScale below it. */
+	UFUNCTION(BlueprintPure, Category = "WidgetAnimation")
+	float GetTransitionDurationScale() const;
+
 protected:
-	AsyncFlow::TTask<void> PlayScaleAnimationTask(
-		UCoreWidget*						 Widget,
+	/** Everything needed to start one transition direction, resolved up front. */
+	struct FWidgetTransitionTween
+	{
+		FVector2D			 StartScale = FVector2D::UnitVector;
+		FVector2D			 EndScale = FVector2D::UnitVector;
+		FVector2D			 StartTranslation = FVector2D::ZeroVector;
+		FVector2D			 EndTranslation = FVector2D::ZeroVector;
+		float				 StartOpacity = 1.0f;
+		float				 EndOpacity = 1.0f;
+		float				 Duration = 0.5f;
+		ECoreTweenEasingType EasingType = ECoreTweenEasingType::Linear;
+		float				 EasingParam = 0.0f;
+		bool				 bTranslation = false;
+	};
+
+	/** Resolve options into a tween for one direction, against the cached viewport size. */
+	FWidgetTransitionTween MakeTransitionTween(
 		const FWidgetTweenTransitionOptions& TransitionOptions,
-		EWidgetTransitionMode				 TransitionMode);
+		EWidgetTransitionMode				 TransitionMode) const;
+
+	/** Notify the widget, start the tween and report completion straight away if it could not start. */
+	FCoreTweenHandle PlayTransitionTween(
+		UCoreWidget*				  Widget,
+		const FWidgetTransitionTween& Tween,
+		EWidgetTransitionMode		  TransitionMode,
+		float						  DurationScale = 1.0f);
+
+	/** Report the widget's running transition as completed, ahead of the transition that replaces it. */
+	void CompleteSupersededTransition(UCoreWidget* Widget);
+
+	/** Start the tween on the widget's world and record it in ActiveTransitions. */
+	FCoreTweenHandle StartWidgetTransition(
+		UCoreWidget*				  Widget,
+		const FWidgetTransitionTween& Tween,
+		EWidgetTransitionMode		  TransitionMode,
+		float						  DurationScale);
+
+	/** OnComplete of a transition tween: drop the table entry and notify the widget. */
+	void OnWidgetTransitionCompleted(UCoreWidget* Widget, EWidgetTransitionMode TransitionMode);
 
-	AsyncFlow::TTask<void> PlayTranslationAnimationTask(
+	/** Rewrite InOutOptions for the current quality tier. @return false at Instant: skip the transition. */
+	bool ApplyTransitionQuality(FWidgetTweenTransitionOptions& InOutOptions, EWidgetTransitionMode TransitionMode) const;
+
+	/** Instant tier: snap the widget to the transition's end state and report it complete. */
+	void SkipTransition(
 		UCoreWidget*						 Widget,
 		const FWidgetTweenTransitionOptions& TransitionOptions,
 		EWidgetTransitionMode				 TransitionMode);
 
-	AsyncFlow::TTask<void> PlayFadeAnimationTask(
+	/** Skip a transition: stop the widget's tweens and write the state it would have ended in. */
+	void SnapToTransitionEnd(
 		UCoreWidget*						 Widget,
 		const FWidgetTweenTransitionOptions& TransitionOptions,
-		EWidgetTransitionMode				 TransitionMode);
+		EWidgetTransitionMode				 TransitionMode) const;
+
+	/** Start and end render translation of a Translation transition, including offsets and outro reversal. */
+	void ResolveTranslationVectors(
+		const FWidgetTweenTransitionOptions& TransitionOptions,
+		EWidgetTransitionMode				 TransitionMode,
+		FVector2D&							 OutStart,
+		FVector2D&							 OutEnd) const;
 
-	static void GetViewportTranslationVectors(
+	/** Offscreen start position for a viewport-origin translation, from the cached viewport size. */
+	void GetViewportTranslationVectors(
 		EWidgetTranslationType TranslationType,
 		FVector2D&			   OutStart,
-		FVector2D&			   OutEnd);
-
-	AsyncFlow::TTask<void> CreateAndPlayTweenTask(
-		UCoreWidget*	 Widget,
-		const FVector2D& StartScale, const FVector2D& EndScale,
-		const FVector2D& StartTranslation, const FVector2D& EndTranslation,
-		float StartOpacity, float EndOpacity, float Duration,
-		ECoreTweenEasingType EasingType, EWidgetTransitionMode TransitionMode);
+		FVector2D&			   OutEnd) const;
 
 private:
-	TMap<FName, FWidgetTweenTransitionOptions> AnimationPresets;
+	/** A registered preset and its tweens, indexed by EWidgetTransitionMode. */
+	struct FCompiledTransitionPreset
+	{
+		FName						  Name;
+		FWidgetTweenTransitionOptions Options;
+		FWidgetTransitionTween		  Tweens[2];
+	};
+
+	/** One running transition. The tween itself lives in the widget world's UCoreTweenWorldSubsystem. */
+	struct FActiveWidgetTransition
+	{
+		TWeakObjectPtr<UCoreWidget> Widget;
+		FCoreTweenHandle			Tween;
+		EWidgetTransitionMode		TransitionMode = EWidgetTransitionMode::Intro;
+	};
+
+	/** Core ticker callback, so it runs while paused. */
+	bool Tick(float DeltaTime);
+
+	/** Sample this frame's load and update TransitionQuality. */
+	void TickTransitionGovernor(float DeltaTime);
+
+	/** Recompile a preset's tweens from its options. */
+	void CompilePreset(FCompiledTransitionPreset& Preset) const;
+
+	/** Read the game viewport size if it has not been seen yet. */
+	void EnsureViewportGeometry();
+
+	/** FViewport::ViewportResizedEvent: refresh the cache when the game viewport changes size. */
+	void HandleViewportResized(FViewport* Viewport, uint32 Unused);
+
+	/** Store a new game viewport size and recompile the presets that translate from the viewport edge. */
+	void SetViewportSize(FIntPoint NewSize);
+
+	/** Drop entries whose widget is gone or whose tween was stopped behind our back (e.g. UCoreTween::Clear). */
+	void PruneTransitions();
+
+	/** Compiled presets; FWidgetTransitionPresetHandle::Index addresses this array. */
+	TArray<FCompiledTransitionPreset> AnimationPresets;
+
+	TMap<FName, int32> AnimationPresetIndices;
+
+	/** Game viewport size the translation vectors are resolved against. Zero until a game viewport is seen. */
+	FIntPoint ViewportSize = FIntPoint::ZeroValue;
+
+	FDelegateHandle ViewportResizedHandle;
+
+	/** At most one running transition per widget. */
+	TMap<TObjectKey<UCoreWidget>, FActiveWidgetTransition> ActiveTransitions;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	EWidgetTransitionQuality TransitionQuality = EWidgetTransitionQuality::Full;
+
+	/** Worst of game thread, render thread and GPU time, averaged over SampleWindowSeconds. */
+	float SmoothedFrameLoadMs = 0.0f;
 
-	/** Active animation task (needs next-frame deferral) */
-	AsyncFlow::TTask<void> ActiveAnimationTask;
+	/** How long the load has called for a better tier than TransitionQuality. */
+	float RecoveryElapsed = 0.0f;
 };
 
@@ -85,8 +85,21 @@ protected:
 	/** Called when an animation completes on this widget */
 	virtual void OnAnimationCompleted(const EWidgetTransitionMode& TransitionMode) override;
 
-	/** Whether animations should be played for this widget */
-	virtual bool ShouldPlayAnimations() const override { return true; }
+	/** Whether animations should be played for this widget. False once the transition governor reaches Instant. */
+	virtual bool ShouldPlayAnimations() const override;
+
+	/** Tier UTweenManagerSubsystem currently plays transitions at (Full without it). */
+	EWidgetTransitionQuality GetTransitionQuality() const;
+
+	/**
+	 * Whether Show()/Hide() play Animation as authored. True up to the Shortened
+	 * tier, where it plays faster; below that, under heavy load, the UMG
+	 * animation gives way to the tween path's fade or snap.
+	 */
+	bool ShouldPlayUmgAnimation(const UWidgetAnimation* Animation) const;
+
+	/** Options.PlaybackSpeed, sped up to match the current tier's duration scale. */
+	float GetTransitionPlaybackSpeed(const FWidgetAnimationOptions& Options) const;
 
 	virtual void NativeOnActivated() override;
 	virtual void NativeOnDeactivated() override;
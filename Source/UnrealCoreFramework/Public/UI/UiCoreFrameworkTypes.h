@@ -89,6 +89,71 @@ enum class EWidgetTranslationType : uint8
 	FromBottom,
 };
 
+/**
+ * How much of a widget transition UTweenManagerSubsystem plays. Ordered from
+ * most to least expensive; the transition governor steps down this list as
+ * frame load rises and back up as it recovers.
+ */
+UENUM(BlueprintType)
+enum class EWidgetTransitionQuality : uint8
+{
+	/** Play transitions as authored. */
+	Full,
+	/** Play transitions at a fraction of their authored duration. */
+	Shortened,
+	/** Replace the transition with a short opacity fade. */
+	FadeOnly,
+	/** Skip the transition and snap the widget to its end state. */
+	Instant,
+};
+
+/** Thresholds for the UI transition governor. See UTweenManagerSubsystem::GetTransitionQuality(). */
+USTRUCT(BlueprintType)
+struct FWidgetTransitionGovernorSettings
+{
+	GENERATED_BODY()
+
+	/** When false, transitions always play in full. Off by default: the thresholds are absolute and must be tuned to the project's target frame time. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TransitionGovernor)
+	bool bEnabled = false;
+
+	/** Smoothed frame load (the worst of game thread, render thread and GPU time) above which transitions are shortened. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TransitionGovernor, meta = (ClampMin = "1", Units = "ms"))
+	float ShortenedFrameTimeMs = 20.0f;
+
+	/** Smoothed frame load above which transitions become a fade. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TransitionGovernor, meta = (ClampMin = "1", Units = "ms"))
+	float FadeOnlyFrameTimeMs = 33.0f;
+
+	/** Smoothed frame load above which transitions are skipped. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TransitionGovernor, meta = (ClampMin = "1", Units = "ms"))
+	float InstantFrameTimeMs = 50.0f;
+
+	/** Duration multiplier for Shortened transitions. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TransitionGovernor, meta = (ClampMin = "0.05", ClampMax = "1"))
+	float ShortenedDurationScale = 0.5f;
+
+	/** Longest duration of a FadeOnly transition. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TransitionGovernor, meta = (ClampMin = "0", Units = "s"))
+	float FadeOnlyDuration = 0.15f;
+
+	/** Time window the frame load is averaged over. A single hitch moves the average at most a quarter of the way. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TransitionGovernor, meta = (ClampMin = "0.05", Units = "s"))
+	float SampleWindowSeconds = 0.5f;
+
+	/** Load must stay below a tier's threshold this long before quality steps back up one tier. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TransitionGovernor, meta = (ClampMin = "0", Units = "s"))
+	float RecoveryDelaySeconds = 1.0f;
+
+	/** Effects scalability level (0 = Low) at or below which the device counts as low tier. -1 disables the tier cap. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TransitionGovernor, meta = (ClampMin = "-1", ClampMax = "4"))
+	int32 LowTierScalabilityLevel = 0;
+
+	/** Best quality a low-tier device plays, whatever its frame load. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TransitionGovernor)
+	EWidgetTransitionQuality LowTierQuality = EWidgetTransitionQuality::Shortened;
+};
+
 USTRUCT(BlueprintType)
 struct FCommonUiTransitionOptions
 {
@@ -149,6 +214,18 @@ struct FWidgetTweenTransitionOptions
 	FVector2D TranslationToOffset;
 };
 
+/** Slot of a transition preset compiled by UTweenManagerSubsystem. Stays valid for the subsystem's lifetime. */
+USTRUCT(BlueprintType)
+struct FWidgetTransitionPresetHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Index = INDEX_NONE;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+};
+
 USTRUCT(BlueprintType)
 struct FWidgetAnimationOptions
 {
@@ -70,6 +70,7 @@ public class UnrealCoreFramework : ModuleRules
 				"CoreUObject",
 				"DeveloperSettings",
 				"Engine",
+				"RenderCore",
 				"Slate",
 				"SlateCore",
 				"OnlineSubsystemUtils"